@@ -3,7 +3,7 @@
 //! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @edited 			n/a
 //! @created			2014/01/21
-//! @last-modified 		2014/01/21
+//! @last-modified 		2026/10/17
 //! @brief 				API header for the Park transform library. This is the only file you need to include to use the library.
 //! @details
 //!						See the README in the repo root dir for more info.
@@ -20,7 +20,21 @@
 #endif
 
 // Library headers
+#include "../include/BinaryAngle.hpp"
+#include "../include/Rotation.hpp"
+#include "../include/RotationStream.hpp"
+#include "../include/SinCosLut.hpp"
+#include "../include/PolySinCos.hpp"
+#include "../include/BasicTransformer.hpp"
 #include "../include/Transformer.hpp"
+#include "../include/Simd.hpp"
+#include "../include/TraceRecorder.hpp"
+#include "../include/SpscRing.hpp"
+#include "../include/ForwardStage.hpp"
+#include "../include/ThreadPool.hpp"
+#include "../include/ParallelTransformer.hpp"
+#include "../include/SampleFile.hpp"
+#include "../include/DqLog.hpp"
 
 #endif // #ifndef PARK_TRANSFORM_PARK_TRANSFORM_H
 
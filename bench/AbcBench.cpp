@@ -0,0 +1,62 @@
+//!
+//! @file 			AbcBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Separate Clarke pass + ForwardBatch() vs. the fused ForwardFromABCBatch().
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	static const size_t numSamples = 1 << 16;
+	static const int numReps = 50;
+
+	BENCH(AbcBench)
+	{
+		static double a[numSamples], b[numSamples], c[numSamples], theta[numSamples];
+		static double alpha[numSamples], beta[numSamples], d[numSamples], q[numSamples], zero[numSamples];
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			theta[i] = 0.001*i;
+			a[i] = cos(theta[i]);
+			b[i] = cos(theta[i] - 2.0*M_PI/3.0);
+			c[i] = -a[i] - b[i];
+		}
+
+		ParkTransform::Transformer transformer;
+
+		double start = NowNs();
+		for(int rep = 0; rep < numReps; rep++)
+		{
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				alpha[i] = (2.0*a[i] - b[i] - c[i])*(1.0/3.0);
+				beta[i] = (b[i] - c[i])*0.57735026918962576451;
+				zero[i] = (a[i] + b[i] + c[i])*(1.0/3.0);
+			}
+			transformer.ForwardBatch(alpha, beta, theta, d, q, numSamples);
+		}
+		Report("Clarke pass + ForwardBatch()", (NowNs() - start)/((double)numSamples*numReps));
+		DoNotOptimise(d[numSamples - 1] + zero[numSamples - 1]);
+
+		start = NowNs();
+		for(int rep = 0; rep < numReps; rep++)
+			transformer.ForwardFromABCBatch(a, b, c, theta, d, q, zero, numSamples);
+		Report("ForwardFromABCBatch()", (NowNs() - start)/((double)numSamples*numReps));
+		DoNotOptimise(d[numSamples - 1] + zero[numSamples - 1]);
+
+		start = NowNs();
+		for(int rep = 0; rep < numReps; rep++)
+			transformer.ForwardFromABBatch(a, b, theta, d, q, numSamples);
+		Report("ForwardFromABBatch() (two sensors)", (NowNs() - start)/((double)numSamples*numReps));
+		DoNotOptimise(d[numSamples - 1]);
+	}
+
+} // namespace ParkTransformBench
@@ -0,0 +1,170 @@
+//!
+//! @file 			AccuracyBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Accuracy vs. speed of the fixed-point transforms, across CDP, LUT size and
+//!					interpolation mode.
+//! @details
+//!					See README.rst in root dir for more info.
+//!					Each point is the same kernel the library's Fp::fp<CDP> methods compile to
+//!					(LutPositionAngle + LutTrig, see Transformer.cpp), with a 32-bit QFixed of CDP
+//!					fraction bits standing in for fp<CDP>. Run on its own with
+//!					'ParkTransformBench.elf --filter AccuracyBench'.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	static const int numAccuracySamples = 1 << 16;
+	static const size_t numTimedCalls = 1 << 21;
+
+	//! Peak alpha/beta, in the same units as d and q (e.g. per-unit current)
+	static const double amplitude = 1.0;
+
+	static const LutStorage storage =
+		(configPARK_LUT_QUARTER_WAVE == 1) ? LutStorage::QUARTER_WAVE : LutStorage::FULL_WAVE;
+
+	//! One grid point, kept for the summary
+	struct AccuracyPoint
+	{
+		int cdp;
+		uint32_t lutSize;
+		bool interpolated;
+		double maxError;		//!< Worse of d and q
+		double nsPerSample;
+	};
+
+	static const size_t maxNumPoints = 64;
+	static AccuracyPoint _points[maxNumPoints];
+	static size_t _numPoints = 0;
+
+	template <int cdp, uint32_t lutSize, LutInterpolation interpolation>
+	static void RunAccuracyPoint()
+	{
+		typedef QFixed<int32_t, cdp> Fixed;
+		typedef ScalarTraits<Fixed> S;
+		typedef SinCosLut<lutSize, cdp, storage> Lut;
+		typedef BasicTransformer<Fixed, LutPositionAngle<Fixed, lutSize>, LutTrig<Lut, interpolation> > FixedTransformer;
+
+		// Error against double maths on the same (quantised) inputs. theta is measured in LUT
+		// entries and steps by an irrational amount, so it lands between entries.
+		double maxErrorD = 0.0, maxErrorQ = 0.0, sumSqD = 0.0, sumSqQ = 0.0;
+		for(int i = 0; i < numAccuracySamples; i++)
+		{
+			Fixed alpha = S::FromDouble(amplitude*cos(0.7071*i));
+			Fixed beta = S::FromDouble(amplitude*sin(0.3183*i));
+			Fixed theta = S::FromDouble(fmod(0.6180339887*i, 1.0)*lutSize);
+
+			Fixed d, q;
+			FixedTransformer::Forward(alpha, beta, theta, &d, &q);
+
+			double angle = S::ToDouble(theta)*2.0*M_PI/lutSize;
+			double a = S::ToDouble(alpha), b = S::ToDouble(beta);
+			double errorD = fabs(a*cos(angle) + b*sin(angle) - S::ToDouble(d));
+			double errorQ = fabs(b*cos(angle) - a*sin(angle) - S::ToDouble(q));
+			maxErrorD = fmax(maxErrorD, errorD);
+			maxErrorQ = fmax(maxErrorQ, errorQ);
+			sumSqD += errorD*errorD;
+			sumSqQ += errorQ*errorQ;
+		}
+		double rmsErrorD = sqrt(sumSqD/numAccuracySamples);
+		double rmsErrorQ = sqrt(sumSqQ/numAccuracySamples);
+
+		// Cost
+		Fixed alpha = S::FromDouble(0.5*amplitude), beta = S::FromDouble(-0.25*amplitude);
+		const uint64_t rawPerTurn = (uint64_t)lutSize << cdp;
+		int32_t acc = 0;
+		Stopwatch stopwatch;
+		for(size_t i = 0; i < numTimedCalls; i++)
+		{
+			Fixed theta, d, q;
+			theta.raw = (int32_t)(((uint64_t)i*2654435761u) % rawPerTurn);
+			FixedTransformer::Forward(alpha, beta, theta, &d, &q);
+			acc += d.raw ^ q.raw;
+		}
+		Timing timing = stopwatch.PerSample((double)numTimedCalls);
+		DoNotOptimise((double)acc);
+
+		const bool interpolated = (interpolation == LutInterpolation::LINEAR);
+		char name[96];
+		snprintf(name, sizeof(name), "CDP %2d, LUT%-5u %-8s d %.1e/%.1e q %.1e/%.1e",
+			cdp, (unsigned)lutSize, interpolated ? "linear" : "truncate",
+			maxErrorD, rmsErrorD, maxErrorQ, rmsErrorQ);
+		const Param params[] = {
+			{ "cdp", (double)cdp }, { "lutSize", (double)lutSize }, { "interpolated", interpolated ? 1.0 : 0.0 },
+			{ "maxErrorD", maxErrorD }, { "rmsErrorD", rmsErrorD },
+			{ "maxErrorQ", maxErrorQ }, { "rmsErrorQ", rmsErrorQ } };
+		Report(name, timing, params, sizeof(params)/sizeof(params[0]));
+
+		if(_numPoints < maxNumPoints)
+		{
+			AccuracyPoint point = { cdp, lutSize, interpolated, fmax(maxErrorD, maxErrorQ), timing.nsPerSample };
+			_points[_numPoints++] = point;
+		}
+	}
+
+	template <int cdp, uint32_t lutSize>
+	static void RunAccuracyLut()
+	{
+		// theta is measured in LUT entries, so a full turn must fit in the 32-bit raw value
+		if(((uint64_t)lutSize << cdp) > ((uint64_t)1 << 31))
+		{
+			printf("CDP %2d, LUT%-5u skipped, theta cannot hold a full turn\n", cdp, (unsigned)lutSize);
+			return;
+		}
+
+		RunAccuracyPoint<cdp, lutSize, LutInterpolation::NONE>();
+		RunAccuracyPoint<cdp, lutSize, LutInterpolation::LINEAR>();
+	}
+
+	template <int cdp>
+	static void RunAccuracyCdp()
+	{
+		RunAccuracyLut<cdp, 64>();
+		RunAccuracyLut<cdp, 256>();
+		RunAccuracyLut<cdp, 1024>();
+		RunAccuracyLut<cdp, 4096>();
+	}
+
+	//! Prints the points no other point beats on both max error and cost, cheapest first.
+	//! The cheapest one under the error budget is the configuration to pick.
+	static void PrintParetoFront()
+	{
+		printf("# Pareto front (max error, ns/sample):\n");
+		double bestError = HUGE_VAL;
+		for(;;)
+		{
+			// Cheapest point more accurate than every point printed so far
+			const AccuracyPoint *next = NULL;
+			for(size_t i = 0; i < _numPoints; i++)
+			{
+				if(_points[i].maxError < bestError && (!next || _points[i].nsPerSample < next->nsPerSample))
+					next = &_points[i];
+			}
+			if(!next)
+				break;
+			bestError = next->maxError;
+			printf("#   CDP %2d, LUT%-5u %-8s %.1e %6.2f\n", next->cdp, (unsigned)next->lutSize,
+				next->interpolated ? "linear" : "truncate", next->maxError, next->nsPerSample);
+		}
+	}
+
+	BENCH(AccuracyBench)
+	{
+		RunAccuracyCdp<8>();
+		RunAccuracyCdp<12>();
+		RunAccuracyCdp<16>();
+		RunAccuracyCdp<20>();
+		RunAccuracyCdp<24>();
+		PrintParetoFront();
+	}
+
+} // namespace ParkTransformBench
@@ -0,0 +1,137 @@
+//!
+//! @file 			Bench.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Minimal benchmark registration and timing helpers.
+//! @details
+//!					See README.rst in root dir for more info.
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_BENCH_BENCH_H
+#define PARK_TRANSFORM_BENCH_BENCH_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>		// __rdtsc()
+#endif
+
+namespace ParkTransformBench
+{
+	typedef void (*BenchFunc)();
+
+	//! @brief		Registers a benchmark function at static-initialisation time.
+	class Registrar
+	{
+	public:
+		Registrar(const char *name, BenchFunc func);
+	};
+
+	//! @brief		Runs every registered benchmark, in registration order.
+	void RunAll();
+
+	//! @brief		Returns a monotonic timestamp, in nanoseconds.
+	inline double NowNs()
+	{
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (double)ts.tv_sec*1e9 + (double)ts.tv_nsec;
+	}
+
+	//! @brief		Returns the CPU timestamp counter (rdtsc), or 0 where there is none.
+	//! @details	On current x86 CPUs the TSC ticks at a constant reference rate, which is close to,
+	//!				but not always exactly, the core clock (turbo and power saving change the latter).
+	inline uint64_t NowCycles()
+	{
+		#if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+		#else
+			return 0;
+		#endif
+	}
+
+	//! @brief		Time per sample of one measured loop.
+	struct Timing
+	{
+		double nsPerSample;
+		double cyclesPerSample;
+	};
+
+	//! @brief		Reads both clocks on construction, and again in PerSample().
+	class Stopwatch
+	{
+	public:
+		Stopwatch() : _startNs(NowNs()), _startCycles(NowCycles()) {}
+
+		Timing PerSample(double numSamples) const
+		{
+			uint64_t cycles = NowCycles() - _startCycles;
+			Timing timing;
+			timing.nsPerSample = (NowNs() - _startNs)/numSamples;
+			timing.cyclesPerSample = (double)cycles/numSamples;
+			return timing;
+		}
+
+	private:
+		double _startNs;
+		uint64_t _startCycles;
+	};
+
+	//! @brief		TSC ticks per nanosecond, measured once at startup (0 where there is no TSC).
+	double CyclesPerNs();
+
+	//! @brief		Prints one result line and records it for the JSON output.
+	//! @details	Cycles are converted from nsPerSample with CyclesPerNs().
+	void Report(const char *name, double nsPerSample);
+
+	//! @brief		A named value recorded with a result, e.g. the swept batch size.
+	struct Param
+	{
+		const char *name;
+		double value;
+	};
+
+	//! @brief		As above, with cycles measured by a Stopwatch.
+	//! @details	params, if given, are written as their own JSON fields (at most maxNumParams).
+	void Report(const char *name, const Timing &timing, const Param *params = NULL, size_t numParams = 0);
+
+	//! @brief		As above, with a single parameter.
+	inline void Report(const char *name, const Timing &timing, const char *paramName, double paramValue)
+	{
+		Param param = { paramName, paramValue };
+		Report(name, timing, &param, 1);
+	}
+
+	//! @brief		Maximum number of Params recorded per result.
+	static const size_t maxNumParams = 8;
+
+	//! @brief		Written to by DoNotOptimise().
+	extern volatile double benchSink;
+
+	//! @brief		Stops the compiler from optimising away a computed value.
+	inline void DoNotOptimise(double value)
+	{
+		benchSink = value;
+	}
+
+} // namespace ParkTransformBench
+
+//! @brief		Defines and registers a benchmark function.
+#define BENCH(name) \
+	static void name(); \
+	static ParkTransformBench::Registrar name##Registrar(#name, name); \
+	static void name()
+
+#endif // #ifndef PARK_TRANSFORM_BENCH_BENCH_H
+
+// EOF
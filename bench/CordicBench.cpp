@@ -0,0 +1,82 @@
+//!
+//! @file 			CordicBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Fixed-point Forward() with CORDIC (sin/cos, or rotating the vector) vs. LUT sin/cos.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	static const size_t numCalls = 1 << 22;
+
+	//! CordicTrig without Rotate(), so Forward() multiplies by the CORDIC sin/cos
+	template <int numIterations>
+	struct CordicSinCosTrig
+	{
+		template <typename T, class AnglePolicy>
+		static Rotation<T> CalcRotation(typename AnglePolicy::angle_type theta)
+		{
+			return CordicTrig<numIterations>::template CalcRotation<T, AnglePolicy>(theta);
+		}
+	};
+
+	template <class Trig>
+	static void RunCordicBench(const char *name, uint32_t numTableBytes)
+	{
+		typedef BasicTransformer<Q31, BamAngle<uint32_t>, Trig> Q31Transformer;
+		typedef ScalarTraits<Q31> S;
+
+		// Accuracy of d against double maths
+		double maxError = 0.0;
+		for(uint32_t i = 0; i < 65536; i++)
+		{
+			Bam32 theta(i*65537u);
+			Q31 d, q;
+			Q31Transformer::Forward(S::FromDouble(0.5), S::FromDouble(0.0), theta, &d, &q);
+			maxError = fmax(maxError, fabs(0.5*cos(theta.ToRadians()) - S::ToDouble(d)));
+		}
+
+		Q31 alpha = S::FromDouble(0.5), beta = S::FromDouble(-0.25);
+		int32_t acc = 0;
+		double start = NowNs();
+		for(size_t i = 0; i < numCalls; i++)
+		{
+			Q31 d, q;
+			Q31Transformer::Forward(alpha, beta, Bam32((uint32_t)(i*2654435761u)), &d, &q);
+			acc += d.raw ^ q.raw;
+		}
+		double nsPerCall = (NowNs() - start)/numCalls;
+		DoNotOptimise((double)acc);
+
+		char line[96];
+		snprintf(line, sizeof(line), "Q31 Forward(), %s (%u B, max err %.1e)", name, (unsigned)numTableBytes, maxError);
+		Report(line, nsPerCall);
+	}
+
+	BENCH(CordicBench)
+	{
+		typedef SinCosLut<256, 30, LutStorage::QUARTER_WAVE> Lut256;
+		typedef SinCosLut<4096, 30, LutStorage::QUARTER_WAVE> Lut4096;
+		RunCordicBench<LutTrig<Lut256> >("LUT256 quarter", Lut256::numBytes);
+		RunCordicBench<LutTrig<Lut256, LutInterpolation::LINEAR> >("LUT256 quarter, linear", Lut256::numBytes);
+		RunCordicBench<LutTrig<Lut4096, LutInterpolation::LINEAR> >("LUT4096 quarter, linear", Lut4096::numBytes);
+		RunCordicBench<CordicSinCosTrig<12> >("CORDIC 12 sin/cos", 12*4);
+		RunCordicBench<CordicSinCosTrig<16> >("CORDIC 16 sin/cos", 16*4);
+		RunCordicBench<CordicSinCosTrig<24> >("CORDIC 24 sin/cos", 24*4);
+		RunCordicBench<CordicTrig<12> >("CORDIC 12 rotate", 12*4);
+		RunCordicBench<CordicTrig<16> >("CORDIC 16 rotate", 16*4);
+		RunCordicBench<CordicTrig<24> >("CORDIC 24 rotate", 24*4);
+	}
+
+} // namespace ParkTransformBench
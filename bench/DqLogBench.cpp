@@ -0,0 +1,82 @@
+//!
+//! @file 			DqLogBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Compression ratio and encode/decode speed of d-q logs.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <stdio.h>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	static const size_t numLogSamples = 1 << 20;
+
+	//! Steady state d and q with 1e-3 of noise, at the given scale
+	template <typename T>
+	static void BenchDqLog(const char *typeName, SampleType type, double scale, uint8_t cdp)
+	{
+		static const size_t blockSize = configPARK_DQ_LOG_BLOCK_SIZE;
+		std::vector<T> d(numLogSamples), q(numLogSamples);
+		uint32_t seed = 1;
+		for(size_t i = 0; i < numLogSamples; i++)
+		{
+			seed = seed*1664525u + 1013904223u;
+			double noise = ((double)(seed >> 8)/(double)(1 << 24) - 0.5)*1e-3;
+			d[i] = (T)((0.02 + noise)*scale);
+			q[i] = (T)((0.8 - noise)*scale);
+		}
+
+		DqLogEncoder encoder(type, 20000.0, cdp);
+		std::vector<uint8_t> log(DqLogEncoder::headerSize + DqLogEncoder::MaxBlockSize(blockSize)*(numLogSamples/blockSize) + 1);
+
+		Stopwatch encodeStopwatch;
+		size_t size = encoder.EncodeHeader(&log[0]);
+		for(size_t start = 0; start < numLogSamples; start += blockSize)
+			size += encoder.EncodeBlock(&d[start], &q[start], blockSize, &log[size]);
+		size += encoder.EncodeEnd(&log[size]);
+		Timing encodeTiming = encodeStopwatch.PerSample((double)numLogSamples);
+
+		DqLogDecoder decoder;
+		static T dBlock[blockSize], qBlock[blockSize];
+		Stopwatch decodeStopwatch;
+		size_t pos, numUsed, num;
+		decoder.DecodeHeader(&log[0], size, &pos);
+		while(decoder.DecodeBlock(&log[pos], size - pos, dBlock, qBlock, &num, &numUsed) == DqLogStatus::OK)
+			pos += numUsed;
+		Timing decodeTiming = decodeStopwatch.PerSample((double)numLogSamples);
+		DoNotOptimise(dBlock[0]);
+
+		double bytesPerSample = (double)size/(double)numLogSamples;
+		char name[128];
+		const Param params[] = {
+			{ "bytesPerSample", bytesPerSample },
+			{ "ratio", 2.0*sizeof(T)/bytesPerSample } };
+		snprintf(name, sizeof(name), "DqLogEncoder::EncodeBlock(), %s", typeName);
+		Report(name, encodeTiming, params, 2);
+
+		const Param decodeParams[] = {
+			{ "bytesPerSample", bytesPerSample },
+			{ "inMBps", bytesPerSample*1e3/decodeTiming.nsPerSample } };
+		snprintf(name, sizeof(name), "DqLogDecoder::DecodeBlock(), %s", typeName);
+		Report(name, decodeTiming, decodeParams, 2);
+		printf("  %.2f bytes/sample (%.1fx smaller than raw), decodes %.0f MB/s of log\n",
+			bytesPerSample, 2.0*sizeof(T)/bytesPerSample, bytesPerSample*1e3/decodeTiming.nsPerSample);
+	}
+
+	BENCH(DqLogBench)
+	{
+		BenchDqLog<double>("FLOAT64", SampleType::FLOAT64, 1.0, 0);
+		BenchDqLog<float>("FLOAT32", SampleType::FLOAT32, 1.0, 0);
+		BenchDqLog<int32_t>("INT32, CDP 16", SampleType::INT32, 65536.0, 16);
+	}
+
+} // namespace ParkTransformBench
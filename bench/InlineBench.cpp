@@ -0,0 +1,59 @@
+//!
+//! @file 			InlineBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Call overhead of the library scalar functions vs. the inline, by-value forms.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using ParkTransform::Transformer;
+	using ParkTransform::BasicTransformer;
+	using ParkTransform::Rotation;
+	using ParkTransform::Dq;
+	using ParkTransform::AlphaBeta;
+
+	static const size_t numIterations = 1 << 24;
+
+	//! One FOC-style step per iteration: forward, a proportional "controller" on d and q, then
+	//! inverse, all at one precomputed rotation. The trig is hoisted so the call overhead dominates.
+	BENCH(InlineBench)
+	{
+		Transformer transformer;
+		Rotation<double> rotation = transformer.CalcRotation(0.7);
+
+		{
+			double alpha = 0.3, beta = 0.4;
+			double start = NowNs();
+			for(size_t i = 0; i < numIterations; i++)
+			{
+				double d, q;
+				transformer.Forward(alpha, beta, rotation, &d, &q);
+				transformer.Inverse(0.5*d + 0.1, 0.5*q, rotation, &alpha, &beta);
+			}
+			Report("Library Forward()+Inverse(), out-pointers", (NowNs() - start)/numIterations);
+			DoNotOptimise(alpha + beta);
+		}
+
+		{
+			AlphaBeta<double> ab = { 0.3, 0.4 };
+			double start = NowNs();
+			for(size_t i = 0; i < numIterations; i++)
+			{
+				Dq<double> dq = BasicTransformer<double>::Forward(ab.alpha, ab.beta, rotation);
+				ab = BasicTransformer<double>::Inverse(0.5*dq.d + 0.1, 0.5*dq.q, rotation);
+			}
+			Report("Inline Forward()+Inverse(), by value", (NowNs() - start)/numIterations);
+			DoNotOptimise(ab.alpha + ab.beta);
+		}
+	}
+
+} // namespace ParkTransformBench
@@ -0,0 +1,70 @@
+//!
+//! @file 			LutBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Accuracy and speed of each LUT storage/interpolation mode.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using ParkTransform::SinCosLut;
+	using ParkTransform::LutStorage;
+	using ParkTransform::LutInterpolation;
+
+	static const uint32_t lutSize = 256;
+	static const uint8_t lutFracBits = 16;
+	static const uint8_t posFracBits = 8;
+	static const size_t numLookups = 1 << 22;
+
+	template <LutStorage storage, LutInterpolation interpolation>
+	static void RunLutBench(const char *name)
+	{
+		typedef SinCosLut<lutSize, lutFracBits, storage> Lut;
+		const int32_t turn = (int32_t)(lutSize << posFracBits);
+
+		// Accuracy, every position in one turn
+		double maxError = 0.0;
+		for(int32_t position = 0; position < turn; position++)
+		{
+			int32_t sinRaw, cosRaw;
+			ParkTransform::LutSinCos<Lut, posFracBits, interpolation>(position, &sinRaw, &cosRaw);
+			double angle = 2.0*M_PI*(double)position/(double)turn;
+			maxError = fmax(maxError, fabs(sin(angle) - ldexp(sinRaw, -lutFracBits)));
+			maxError = fmax(maxError, fabs(cos(angle) - ldexp(cosRaw, -lutFracBits)));
+		}
+
+		// Speed, positions stepped by an odd amount so consecutive lookups hit different entries
+		int32_t acc = 0;
+		double start = NowNs();
+		for(size_t i = 0; i < numLookups; i++)
+		{
+			int32_t sinRaw, cosRaw;
+			ParkTransform::LutSinCos<Lut, posFracBits, interpolation>((int32_t)((i*40503u) % (uint32_t)turn), &sinRaw, &cosRaw);
+			acc += sinRaw ^ cosRaw;
+		}
+		double nsPerLookup = (NowNs() - start)/numLookups;
+		DoNotOptimise((double)acc);
+
+		char line[96];
+		snprintf(line, sizeof(line), "%s (%u B, max err %.2e)", name, (unsigned)Lut::numBytes, maxError);
+		Report(line, nsPerLookup);
+	}
+
+	BENCH(LutBench)
+	{
+		RunLutBench<LutStorage::FULL_WAVE, LutInterpolation::NONE>("LUT256 full, truncate");
+		RunLutBench<LutStorage::FULL_WAVE, LutInterpolation::LINEAR>("LUT256 full, linear");
+		RunLutBench<LutStorage::QUARTER_WAVE, LutInterpolation::NONE>("LUT256 quarter, truncate");
+		RunLutBench<LutStorage::QUARTER_WAVE, LutInterpolation::LINEAR>("LUT256 quarter, linear");
+	}
+
+} // namespace ParkTransformBench
@@ -0,0 +1,65 @@
+//!
+//! @file 			ParallelBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Scaling of ParallelTransformer::ForwardBatch() with the number of threads.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <stdio.h>
+#include <math.h>
+#include <thread>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	//! Well beyond the last level cache, like a recorded drive log
+	static const size_t numParallelSamples = 1 << 23;
+
+	BENCH(ParallelBench)
+	{
+		std::vector<double> alpha(numParallelSamples), beta(numParallelSamples), theta(numParallelSamples);
+		std::vector<double> d(numParallelSamples), q(numParallelSamples);
+		for(size_t i = 0; i < numParallelSamples; i++)
+		{
+			alpha[i] = cos(0.001*i);
+			beta[i] = sin(0.001*i);
+			theta[i] = 0.013*(double)(i & 0xFFFF);
+		}
+
+		unsigned maxThreads = std::thread::hardware_concurrency();
+		if(maxThreads == 0)
+			maxThreads = 1;
+		printf("  %u hardware threads\n", maxThreads);
+
+		double nsPerSampleOne = 0.0;
+		for(unsigned numThreads = 1; numThreads <= 2*maxThreads && numThreads <= 64; numThreads *= 2)
+		{
+			ParallelTransformer transformer(numThreads);
+			transformer.ForwardBatch(&alpha[0], &beta[0], &theta[0], &d[0], &q[0], numParallelSamples);
+
+			Stopwatch stopwatch;
+			for(int rep = 0; rep < 4; rep++)
+				transformer.ForwardBatch(&alpha[0], &beta[0], &theta[0], &d[0], &q[0], numParallelSamples);
+			Timing timing = stopwatch.PerSample(4.0*numParallelSamples);
+			DoNotOptimise(d[numParallelSamples/2]);
+
+			if(numThreads == 1)
+				nsPerSampleOne = timing.nsPerSample;
+			double speedup = nsPerSampleOne/timing.nsPerSample;
+
+			char name[96];
+			snprintf(name, sizeof(name), "ParallelTransformer ForwardBatch<double>, %2u threads (x%.2f)", numThreads, speedup);
+			const Param params[] = { { "numThreads", (double)numThreads }, { "speedup", speedup } };
+			Report(name, timing, params, 2);
+		}
+	}
+
+} // namespace ParkTransformBench
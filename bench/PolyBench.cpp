@@ -0,0 +1,81 @@
+//!
+//! @file 			PolyBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Forward() with each PolySinCos() tier vs. libm, scalar and batch.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	static const size_t numCalls = 1 << 22;
+	static const size_t numSamples = 4096;
+	static const size_t numRepeats = 1000;
+
+	template <class Trig>
+	static void RunScalar(const char *name)
+	{
+		typedef BasicTransformer<double, RadianAngle<double>, Trig> ScalarTransformer;
+		double acc = 0.0;
+		double start = NowNs();
+		for(size_t i = 0; i < numCalls; i++)
+		{
+			double d, q;
+			ScalarTransformer::Forward(0.5, -0.25, (double)(i & 0xFFFF)*0.001, &d, &q);
+			acc += d + q;
+		}
+		double nsPerCall = (NowNs() - start)/numCalls;
+		DoNotOptimise(acc);
+		Report(name, nsPerCall);
+	}
+
+	template <typename T>
+	static void RunBatch(const char *typeName, PolyAccuracy accuracy, const char *tierName)
+	{
+		std::vector<T> alpha(numSamples), beta(numSamples), theta(numSamples), d(numSamples), q(numSamples);
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			alpha[i] = (T)cos(0.01*i);
+			beta[i] = (T)sin(0.01*i);
+			theta[i] = (T)(0.013*i);
+		}
+
+		Simd::Isa isa = Simd::GetBestIsa();
+		double start = NowNs();
+		for(size_t r = 0; r < numRepeats; r++)
+			Simd::ForwardBatch(isa, accuracy, &alpha[0], &beta[0], &theta[0], &d[0], &q[0], numSamples);
+		double nsPerSample = (NowNs() - start)/(numRepeats*numSamples);
+		DoNotOptimise((double)d[numSamples/2]);
+
+		char line[96];
+		snprintf(line, sizeof(line), "%s ForwardBatch(), %s, %s", typeName, Simd::GetIsaName(isa), tierName);
+		Report(line, nsPerSample);
+	}
+
+	BENCH(PolyBench)
+	{
+		RunScalar<LibmTrig>("double Forward(), libm");
+		RunScalar<PolyTrig<PolyAccuracy::LOW> >("double Forward(), poly LOW");
+		RunScalar<PolyTrig<PolyAccuracy::MEDIUM> >("double Forward(), poly MEDIUM");
+		RunScalar<PolyTrig<PolyAccuracy::FULL> >("double Forward(), poly FULL");
+
+		const PolyAccuracy tiers[] = { PolyAccuracy::LOW, PolyAccuracy::MEDIUM, PolyAccuracy::FULL };
+		const char *tierNames[] = { "LOW", "MEDIUM", "FULL" };
+		for(int i = 0; i < numPolyAccuracies; i++)
+			RunBatch<double>("double", tiers[i], tierNames[i]);
+		for(int i = 0; i < numPolyAccuracies; i++)
+			RunBatch<float>("float", tiers[i], tierNames[i]);
+	}
+
+} // namespace ParkTransformBench
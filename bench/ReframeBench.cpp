@@ -0,0 +1,75 @@
+//!
+//! @file 			ReframeBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Inverse() then Forward() vs. the single rotation of Reframe().
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	static const size_t numReframeSamples = 1 << 16;
+	static const int numReframeReps = 50;
+
+	BENCH(ReframeBench)
+	{
+		static double d[numReframeSamples], q[numReframeSamples];
+		static double thetaFrom[numReframeSamples], thetaTo[numReframeSamples];
+		static double alpha[numReframeSamples], beta[numReframeSamples];
+		static double dOut[numReframeSamples], qOut[numReframeSamples];
+		for(size_t i = 0; i < numReframeSamples; i++)
+		{
+			d[i] = 0.1 + 1e-3*sin(0.01*i);
+			q[i] = 0.8 - 1e-3*cos(0.01*i);
+			thetaFrom[i] = 0.001*i;
+			thetaTo[i] = 4.0*thetaFrom[i] + 0.3;
+		}
+
+		ParkTransform::Transformer transformer;
+
+		double start = NowNs();
+		for(int rep = 0; rep < numReframeReps; rep++)
+		{
+			for(size_t i = 0; i < numReframeSamples; i++)
+			{
+				double a, b;
+				transformer.Inverse(d[i], q[i], thetaFrom[i], &a, &b);
+				transformer.Forward(a, b, thetaTo[i], &dOut[i], &qOut[i]);
+			}
+		}
+		Report("Inverse() + Forward(), scalar", (NowNs() - start)/((double)numReframeSamples*numReframeReps));
+		DoNotOptimise(dOut[numReframeSamples - 1]);
+
+		start = NowNs();
+		for(int rep = 0; rep < numReframeReps; rep++)
+		{
+			for(size_t i = 0; i < numReframeSamples; i++)
+				transformer.Reframe(d[i], q[i], thetaFrom[i], thetaTo[i], &dOut[i], &qOut[i]);
+		}
+		Report("Reframe(), scalar", (NowNs() - start)/((double)numReframeSamples*numReframeReps));
+		DoNotOptimise(dOut[numReframeSamples - 1]);
+
+		start = NowNs();
+		for(int rep = 0; rep < numReframeReps; rep++)
+		{
+			transformer.InverseBatch(d, q, thetaFrom, alpha, beta, numReframeSamples);
+			transformer.ForwardBatch(alpha, beta, thetaTo, dOut, qOut, numReframeSamples);
+		}
+		Report("InverseBatch() + ForwardBatch()", (NowNs() - start)/((double)numReframeSamples*numReframeReps));
+		DoNotOptimise(dOut[numReframeSamples - 1]);
+
+		start = NowNs();
+		for(int rep = 0; rep < numReframeReps; rep++)
+			transformer.ReframeBatch(d, q, thetaFrom, thetaTo, dOut, qOut, numReframeSamples);
+		Report("ReframeBatch()", (NowNs() - start)/((double)numReframeSamples*numReframeReps));
+		DoNotOptimise(dOut[numReframeSamples - 1]);
+	}
+
+} // namespace ParkTransformBench
@@ -0,0 +1,64 @@
+//!
+//! @file 			SampleFileBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			ForwardFile() from one memory-mapped sample file to another.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+#include <stdio.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	static const size_t numFileSamples = 1 << 22;
+
+	template <typename T>
+	static void BenchForwardFile(const char *name, SampleType type)
+	{
+		const char *inPath = "/tmp/ParkTransformBench_In.pts";
+		const char *outPath = "/tmp/ParkTransformBench_Out.pts";
+
+		SampleFileWriter writer;
+		if(!writer.Create(inPath, SampleLayout::ALPHA_BETA_THETA, type, numFileSamples, 20000.0))
+		{
+			printf("%s: can't create %s\n", name, inPath);
+			return;
+		}
+		for(size_t i = 0; i < numFileSamples; i++)
+		{
+			writer.GetColumn<T>(SampleColumn::ALPHA)[i] = (T)0.5;
+			writer.GetColumn<T>(SampleColumn::BETA)[i] = (T)-0.25;
+			writer.GetColumn<T>(SampleColumn::THETA)[i] = (T)(0.001*(double)(i & 0xFFFF));
+		}
+		writer.Close();
+
+		// The first run faults the pages in, time the second (file in the page cache)
+		ForwardFile(inPath, outPath);
+		Stopwatch stopwatch;
+		bool ok = ForwardFile(inPath, outPath);
+		Timing timing = stopwatch.PerSample((double)numFileSamples);
+		if(!ok)
+			printf("%s: ForwardFile() failed\n", name);
+
+		const Param param = { "inMBps", 3.0*sizeof(T)*1e3/timing.nsPerSample };
+		Report(name, timing, &param, 1);
+
+		remove(inPath);
+		remove(outPath);
+	}
+
+	BENCH(SampleFileBench)
+	{
+		BenchForwardFile<double>("ForwardFile(), FLOAT64, mmap to mmap", SampleType::FLOAT64);
+		BenchForwardFile<float>("ForwardFile(), FLOAT32, mmap to mmap", SampleType::FLOAT32);
+	}
+
+} // namespace ParkTransformBench
@@ -0,0 +1,59 @@
+//!
+//! @file 			SimdBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Measures the batch kernels for each supported instruction set.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	static const size_t numSamples = 1 << 16;
+	static const int numReps = 50;
+
+	template <typename T>
+	static void RunSimdBench(const char *typeName)
+	{
+		using namespace ParkTransform::Simd;
+
+		static T alpha[numSamples], beta[numSamples], theta[numSamples], d[numSamples], q[numSamples];
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			alpha[i] = (T)1.0;
+			beta[i] = (T)0.5;
+			theta[i] = (T)(0.001*i);
+		}
+
+		const Isa isas[] = { Isa::SCALAR, Isa::AVX2, Isa::AVX512 };
+		for(size_t k = 0; k < sizeof(isas)/sizeof(isas[0]); k++)
+		{
+			if(!IsSupported(isas[k]))
+				continue;
+
+			double start = NowNs();
+			for(int rep = 0; rep < numReps; rep++)
+				ForwardBatch(isas[k], alpha, beta, theta, d, q, numSamples);
+			double nsPerSample = (NowNs() - start)/((double)numSamples*numReps);
+
+			char name[64];
+			snprintf(name, sizeof(name), "ForwardBatch<%s>, %s", typeName, GetIsaName(isas[k]));
+			Report(name, nsPerSample);
+			DoNotOptimise((double)d[numSamples - 1]);
+		}
+	}
+
+	BENCH(SimdBench)
+	{
+		RunSimdBench<double>("double");
+		RunSimdBench<float>("float");
+	}
+
+} // namespace ParkTransformBench
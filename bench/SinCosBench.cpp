@@ -0,0 +1,64 @@
+//!
+//! @file 			SinCosBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Compares separate sin()/cos() calls against the fused sincos() double path.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	static const size_t numSamples = 1000000;
+
+	// Called through volatile pointers so the compiler cannot merge them into sincos(),
+	// this reproduces the original four-call Forward()
+	static double (*volatile _sinFunc)(double) = sin;
+	static double (*volatile _cosFunc)(double) = cos;
+
+	BENCH(SinCosBench)
+	{
+		ParkTransform::Transformer parkTransformer;
+		double acc = 0.0;
+
+		double start = NowNs();
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			double alpha = 1.0, beta = 0.5, theta = 1e-5*(double)i;
+			double d = alpha*_cosFunc(theta) + beta*_sinFunc(theta);
+			double q = beta*_cosFunc(theta) - alpha*_sinFunc(theta);
+			acc += d + q;
+		}
+		Report("Forward, 2x sin() + 2x cos()", (NowNs() - start)/numSamples);
+
+		start = NowNs();
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			double alpha = 1.0, beta = 0.5, theta = 1e-5*(double)i;
+			double sinTheta = _sinFunc(theta);
+			double cosTheta = _cosFunc(theta);
+			double d = alpha*cosTheta + beta*sinTheta;
+			double q = beta*cosTheta - alpha*sinTheta;
+			acc += d + q;
+		}
+		Report("Forward, 1x sin() + 1x cos()", (NowNs() - start)/numSamples);
+
+		start = NowNs();
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			double d, q;
+			parkTransformer.Forward(1.0, 0.5, 1e-5*(double)i, &d, &q);
+			acc += d + q;
+		}
+		Report("Transformer::Forward (sincos)", (NowNs() - start)/numSamples);
+
+		DoNotOptimise(acc);
+	}
+
+} // namespace ParkTransformBench
@@ -0,0 +1,67 @@
+//!
+//! @file 			StageBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Throughput, latency and occupancy of a ForwardStage between two threads.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <stdio.h>
+#include <thread>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	static const size_t numStageSamples = 1 << 22;
+
+	BENCH(StageBench)
+	{
+		static ForwardStage stage;
+
+		Stopwatch stopwatch;
+		std::thread producer([]()
+		{
+			for(size_t i = 0; i < numStageSamples; i++)
+			{
+				while(!stage.Push(0.5, -0.25, 0.001*(double)(i & 0xFFFF)))
+					std::this_thread::yield();
+			}
+		});
+
+		static double d[1024], q[1024];
+		size_t numDone = 0;
+		while(numDone < numStageSamples)
+		{
+			size_t num = stage.Process(d, q, 1024);
+			if(num == 0)
+				std::this_thread::yield();
+			numDone += num;
+		}
+		producer.join();
+		Timing timing = stopwatch.PerSample((double)numStageSamples);
+		DoNotOptimise(d[0]);
+
+		StageMetrics metrics = stage.GetMetrics();
+		char line[128];
+		snprintf(line, sizeof(line), "ForwardStage, Push() to Process() (%.0f per call)",
+			(double)metrics.numProcessed/(double)metrics.numProcessCalls);
+		const Param params[] = {
+			{ "meanLatencyNs", metrics.meanLatencyNs },
+			{ "p99LatencyNs", (double)metrics.LatencyPercentileNs(0.99) },
+			{ "maxLatencyNs", (double)metrics.maxLatencyNs },
+			{ "meanOccupancy", metrics.meanOccupancy },
+			{ "maxOccupancy", (double)metrics.maxOccupancy } };
+		Report(line, timing, params, sizeof(params)/sizeof(params[0]));
+		printf("  latency mean %.0f ns, p50 < %llu ns, p99 < %llu ns, max %llu ns; occupancy mean %.0f, max %u\n",
+			metrics.meanLatencyNs, (unsigned long long)metrics.LatencyPercentileNs(0.5),
+			(unsigned long long)metrics.LatencyPercentileNs(0.99), (unsigned long long)metrics.maxLatencyNs,
+			metrics.meanOccupancy, (unsigned)metrics.maxOccupancy);
+	}
+
+} // namespace ParkTransformBench
@@ -0,0 +1,68 @@
+//!
+//! @file 			StreamBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Constant-speed streams: phasor recurrence vs. sincos() and LUT per sample.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	static const size_t numSamples = 1 << 16;
+	static const int numReps = 50;
+	static const double theta0 = 0.1;
+	static const double deltaTheta = 0.003;
+
+	BENCH(StreamBench)
+	{
+		static double alpha[numSamples], beta[numSamples], d[numSamples], q[numSamples];
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			alpha[i] = cos(0.37*i);
+			beta[i] = sin(0.11*i);
+		}
+
+		Transformer transformer;
+
+		double start = NowNs();
+		for(int rep = 0; rep < numReps; rep++)
+			for(size_t i = 0; i < numSamples; i++)
+				transformer.Forward(alpha[i], beta[i], theta0 + deltaTheta*i, &d[i], &q[i]);
+		Report("Forward(), sincos() per sample", (NowNs() - start)/((double)numSamples*numReps));
+		DoNotOptimise(d[numSamples - 1]);
+
+		// 1024 entry Q30 LUT with interpolation, indexed by a binary angle
+		typedef BasicTransformer<double, BamAngle<uint32_t>,
+			LutTrig<SinCosLut<1024, 30>, LutInterpolation::LINEAR> > LutTransformer;
+		Bam32 bam0 = Bam32::FromRadians(theta0);
+		Bam32 bamStep = Bam32::FromRadians(deltaTheta);
+		start = NowNs();
+		for(int rep = 0; rep < numReps; rep++)
+		{
+			Bam32 theta = bam0;
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				LutTransformer::Forward(alpha[i], beta[i], theta, &d[i], &q[i]);
+				theta = theta + bamStep;
+			}
+		}
+		Report("Forward(), LUT1024 linear per sample", (NowNs() - start)/((double)numSamples*numReps));
+		DoNotOptimise(d[numSamples - 1]);
+
+		start = NowNs();
+		for(int rep = 0; rep < numReps; rep++)
+			transformer.ForwardStream(alpha, beta, theta0, deltaTheta, d, q, numSamples);
+		Report("ForwardStream(), phasor recurrence", (NowNs() - start)/((double)numSamples*numReps));
+		DoNotOptimise(d[numSamples - 1]);
+	}
+
+} // namespace ParkTransformBench
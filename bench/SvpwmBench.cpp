@@ -0,0 +1,56 @@
+//!
+//! @file 			SvpwmBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			InverseBatch() + separate SVPWM pass vs. the fused InverseSvpwmBatch().
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	static const size_t numSamples = 1 << 16;
+	static const int numReps = 50;
+
+	BENCH(SvpwmBench)
+	{
+		static double d[numSamples], q[numSamples], theta[numSamples], alpha[numSamples], beta[numSamples];
+		static double dutyA[numSamples], dutyB[numSamples], dutyC[numSamples];
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			d[i] = 0.1;
+			q[i] = 0.4;
+			theta[i] = 0.001*i;
+		}
+
+		ParkTransform::Transformer transformer;
+
+		double start = NowNs();
+		for(int rep = 0; rep < numReps; rep++)
+		{
+			transformer.InverseBatch(d, q, theta, alpha, beta, numSamples);
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				ParkTransform::Abc<double> duties = ParkTransform::SvpwmDuties(alpha[i], beta[i]);
+				dutyA[i] = duties.a;
+				dutyB[i] = duties.b;
+				dutyC[i] = duties.c;
+			}
+		}
+		Report("InverseBatch() + SVPWM pass", (NowNs() - start)/((double)numSamples*numReps));
+		DoNotOptimise(dutyA[numSamples - 1]);
+
+		start = NowNs();
+		for(int rep = 0; rep < numReps; rep++)
+			transformer.InverseSvpwmBatch(d, q, theta, dutyA, dutyB, dutyC, numSamples);
+		Report("InverseSvpwmBatch()", (NowNs() - start)/((double)numSamples*numReps));
+		DoNotOptimise(dutyA[numSamples - 1]);
+	}
+
+} // namespace ParkTransformBench
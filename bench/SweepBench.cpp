@@ -0,0 +1,131 @@
+//!
+//! @file 			SweepBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Sweeps the batch size of each batch path and the LUT size of the fixed-point path.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	//! Every point runs about this many samples in total
+	static const size_t numSamplesPerPoint = 1 << 22;
+
+	static const size_t minBatchSize = 16;
+	static const size_t maxBatchSize = 1 << 20;
+
+	//! Batch size sweep, from L1-resident to well beyond the last level cache
+	template <typename T>
+	static void RunBatchSweep(const char *typeName)
+	{
+		std::vector<T> alpha(maxBatchSize), beta(maxBatchSize), theta(maxBatchSize), d(maxBatchSize), q(maxBatchSize);
+		for(size_t i = 0; i < maxBatchSize; i++)
+		{
+			alpha[i] = (T)cos(0.01*i);
+			beta[i] = (T)sin(0.01*i);
+			theta[i] = (T)(0.013*(i & 0xFFFF));
+		}
+
+		const Simd::Isa isas[] = { Simd::Isa::SCALAR, Simd::Isa::AVX2, Simd::Isa::AVX512 };
+		for(size_t k = 0; k < sizeof(isas)/sizeof(isas[0]); k++)
+		{
+			if(!Simd::IsSupported(isas[k]))
+				continue;
+
+			for(size_t batchSize = minBatchSize; batchSize <= maxBatchSize; batchSize *= 4)
+			{
+				size_t numReps = numSamplesPerPoint/batchSize;
+				if(isas[k] == Simd::Isa::SCALAR)
+					numReps = (numReps + 7)/8;		// The scalar kernel is much slower
+
+				// One untimed pass, so each point starts from the same cache state
+				Simd::ForwardBatch(isas[k], &alpha[0], &beta[0], &theta[0], &d[0], &q[0], batchSize);
+
+				Stopwatch stopwatch;
+				for(size_t rep = 0; rep < numReps; rep++)
+					Simd::ForwardBatch(isas[k], &alpha[0], &beta[0], &theta[0], &d[0], &q[0], batchSize);
+				Timing timing = stopwatch.PerSample((double)(numReps*batchSize));
+				DoNotOptimise((double)d[batchSize - 1]);
+
+				char name[96];
+				snprintf(name, sizeof(name), "ForwardBatch<%s>, %s, n = %u",
+					typeName, Simd::GetIsaName(isas[k]), (unsigned)batchSize);
+				Report(name, timing, "batchSize", (double)batchSize);
+			}
+		}
+	}
+
+	//! Q31 Forward() through a LUT of lutSize entries
+	template <uint32_t lutSize, LutInterpolation interpolation>
+	static void RunLutPoint(const char *interpolationName)
+	{
+		typedef SinCosLut<lutSize, 30, LutStorage::QUARTER_WAVE> Lut;
+		typedef BasicTransformer<Q31, BamAngle<uint32_t>, LutTrig<Lut, interpolation> > Q31Transformer;
+		typedef ScalarTraits<Q31> S;
+
+		Q31 alpha = S::FromDouble(0.5), beta = S::FromDouble(-0.25);
+		int32_t acc = 0;
+		Stopwatch stopwatch;
+		for(size_t i = 0; i < numSamplesPerPoint; i++)
+		{
+			Q31 d, q;
+			Q31Transformer::Forward(alpha, beta, Bam32((uint32_t)(i*2654435761u)), &d, &q);
+			acc += d.raw ^ q.raw;
+		}
+		Timing timing = stopwatch.PerSample((double)numSamplesPerPoint);
+		DoNotOptimise((double)acc);
+
+		char name[96];
+		snprintf(name, sizeof(name), "Q31 Forward(), LUT%u quarter, %s (%u B)",
+			(unsigned)lutSize, interpolationName, (unsigned)Lut::numBytes);
+		Report(name, timing, "lutSize", (double)lutSize);
+	}
+
+	template <LutInterpolation interpolation>
+	static void RunLutSweep(const char *interpolationName)
+	{
+		RunLutPoint<64, interpolation>(interpolationName);
+		RunLutPoint<256, interpolation>(interpolationName);
+		RunLutPoint<1024, interpolation>(interpolationName);
+		RunLutPoint<4096, interpolation>(interpolationName);
+		RunLutPoint<16384, interpolation>(interpolationName);
+	}
+
+	//! The double scalar path, for reference against the batch sweep
+	static void RunDoubleScalar()
+	{
+		Transformer transformer;
+		double acc = 0.0;
+		Stopwatch stopwatch;
+		for(size_t i = 0; i < numSamplesPerPoint; i++)
+		{
+			double d, q;
+			transformer.Forward(0.5, -0.25, 0.013*(double)(i & 0xFFFF), &d, &q);
+			acc += d + q;
+		}
+		Timing timing = stopwatch.PerSample((double)numSamplesPerPoint);
+		DoNotOptimise(acc);
+		Report("double Forward(), scalar", timing);
+	}
+
+	BENCH(SweepBench)
+	{
+		RunDoubleScalar();
+		RunBatchSweep<double>("double");
+		RunBatchSweep<float>("float");
+		RunLutSweep<LutInterpolation::NONE>("truncate");
+		RunLutSweep<LutInterpolation::LINEAR>("linear");
+	}
+
+} // namespace ParkTransformBench
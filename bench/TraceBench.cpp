@@ -0,0 +1,57 @@
+//!
+//! @file 			TraceBench.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Cost of tracing a fixed-point Forward(), NullTrace vs. RecordingTrace.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	using namespace ParkTransform;
+
+	static const size_t numCalls = 1 << 22;
+
+	//! Discards everything drained
+	class NullSink : public TraceSink
+	{
+	public:
+		void OnTrace(const TraceSnapshot &) {}
+	};
+
+	template <class Trace>
+	static void RunTraceBench(const char *name)
+	{
+		typedef BasicTransformer<Q31, BamAngle<uint32_t>,
+			LutTrig<SinCosLut<256, 30, LutStorage::QUARTER_WAVE> >, Trace> Q31Transformer;
+		typedef ScalarTraits<Q31> S;
+
+		NullSink sink;
+		TraceDrainThread drainThread(sink, 10);
+
+		Q31 alpha = S::FromDouble(0.5), beta = S::FromDouble(-0.25);
+		int32_t acc = 0;
+		Stopwatch stopwatch;
+		for(size_t i = 0; i < numCalls; i++)
+		{
+			Q31 d, q;
+			Q31Transformer::Forward(alpha, beta, Bam32((uint32_t)(i*2654435761u)), &d, &q);
+			acc += d.raw ^ q.raw;
+		}
+		Timing timing = stopwatch.PerSample((double)numCalls);
+		DoNotOptimise((double)acc);
+		Report(name, timing);
+	}
+
+	BENCH(TraceBench)
+	{
+		RunTraceBench<NullTrace>("Q31 Forward(), NullTrace");
+		RunTraceBench<RecordingTrace>("Q31 Forward(), RecordingTrace");
+	}
+
+} // namespace ParkTransformBench
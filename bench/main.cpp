@@ -0,0 +1,182 @@
+//!
+//! @file 			main.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Contains main entry point for the benchmarks.
+//! @details
+//!					See README.rst in root dir for more info.
+//!					Usage: ParkTransformBench.elf [--json <file>] [--filter <bench name substring>]
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "Bench.hpp"
+
+namespace ParkTransformBench
+{
+	volatile double benchSink = 0.0;
+
+	static const size_t maxNumBenches = 64;
+	static const size_t maxNumResults = 1024;
+	static const size_t maxNameLength = 96;
+
+	static const char *_names[maxNumBenches];
+	static BenchFunc _funcs[maxNumBenches];
+	static size_t _numBenches = 0;
+
+	//! One recorded result, for the JSON output
+	struct Result
+	{
+		const char *bench;
+		char name[maxNameLength];
+		Timing timing;
+		Param params[maxNumParams];
+		size_t numParams;
+	};
+
+	static Result _results[maxNumResults];
+	static size_t _numResults = 0;
+	static const char *_currentBench = "";
+	static double _cyclesPerNs = -1.0;
+
+	Registrar::Registrar(const char *name, BenchFunc func)
+	{
+		if(_numBenches < maxNumBenches)
+		{
+			_names[_numBenches] = name;
+			_funcs[_numBenches] = func;
+			_numBenches++;
+		}
+	}
+
+	//! Runs the benchmarks whose name contains filter (all of them if filter is NULL)
+	static void Run(const char *filter)
+	{
+		for(size_t i = 0; i < _numBenches; i++)
+		{
+			if(filter && !strstr(_names[i], filter))
+				continue;
+			_currentBench = _names[i];
+			printf("# %s\n", _names[i]);
+			_funcs[i]();
+		}
+	}
+
+	void RunAll()
+	{
+		Run(NULL);
+	}
+
+	double CyclesPerNs()
+	{
+		if(_cyclesPerNs < 0.0)
+		{
+			// Long enough that the clock_gettime() overhead is negligible
+			Stopwatch stopwatch;
+			double start = NowNs();
+			while(NowNs() - start < 50e6) {}
+			Timing timing = stopwatch.PerSample(1.0);
+			_cyclesPerNs = timing.cyclesPerSample/timing.nsPerSample;
+		}
+		return _cyclesPerNs;
+	}
+
+	void Report(const char *name, double nsPerSample)
+	{
+		Timing timing;
+		timing.nsPerSample = nsPerSample;
+		timing.cyclesPerSample = nsPerSample*CyclesPerNs();
+		Report(name, timing);
+	}
+
+	void Report(const char *name, const Timing &timing, const Param *params, size_t numParams)
+	{
+		printf("%-56s %8.2f ns/sample %8.1f cycles/sample\n", name, timing.nsPerSample, timing.cyclesPerSample);
+
+		if(_numResults < maxNumResults)
+		{
+			Result &result = _results[_numResults++];
+			result.bench = _currentBench;
+			snprintf(result.name, sizeof(result.name), "%s", name);
+			result.timing = timing;
+			result.numParams = (numParams < maxNumParams) ? numParams : maxNumParams;
+			for(size_t i = 0; i < result.numParams; i++)
+				result.params[i] = params[i];
+		}
+	}
+
+	//! Writes s as a JSON string, escaping quotes and backslashes
+	static void WriteJsonString(FILE *file, const char *s)
+	{
+		fputc('"', file);
+		for(; *s; s++)
+		{
+			if(*s == '"' || *s == '\\')
+				fputc('\\', file);
+			fputc(*s, file);
+		}
+		fputc('"', file);
+	}
+
+	//! Writes every recorded result to path as JSON. Returns false on failure.
+	static bool WriteJson(const char *path)
+	{
+		FILE *file = fopen(path, "w");
+		if(!file)
+			return false;
+
+		fprintf(file, "{\n\t\"isa\": ");
+		WriteJsonString(file, ParkTransform::Simd::GetIsaName(ParkTransform::Simd::GetBestIsa()));
+		fprintf(file, ",\n\t\"cyclesPerNs\": %.4f,\n\t\"results\": [\n", CyclesPerNs());
+		for(size_t i = 0; i < _numResults; i++)
+		{
+			const Result &result = _results[i];
+			fprintf(file, "\t\t{ \"bench\": ");
+			WriteJsonString(file, result.bench);
+			fprintf(file, ", \"name\": ");
+			WriteJsonString(file, result.name);
+			for(size_t p = 0; p < result.numParams; p++)
+			{
+				fprintf(file, ", ");
+				WriteJsonString(file, result.params[p].name);
+				fprintf(file, ": %.9g", result.params[p].value);
+			}
+			fprintf(file, ", \"nsPerSample\": %.4f, \"cyclesPerSample\": %.3f }%s\n",
+				result.timing.nsPerSample, result.timing.cyclesPerSample, (i + 1 < _numResults) ? "," : "");
+		}
+		fprintf(file, "\t]\n}\n");
+		return fclose(file) == 0;
+	}
+
+} // namespace ParkTransformBench
+
+int main(int argc, char **argv)
+{
+	const char *jsonPath = NULL;
+	const char *filter = NULL;
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "--json") && i + 1 < argc)
+			jsonPath = argv[++i];
+		else if(!strcmp(argv[i], "--filter") && i + 1 < argc)
+			filter = argv[++i];
+		else
+		{
+			fprintf(stderr, "Usage: %s [--json <file>] [--filter <bench name substring>]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	printf("# TSC %.3f cycles/ns\n", ParkTransformBench::CyclesPerNs());
+	ParkTransformBench::Run(filter);
+
+	if(jsonPath && !ParkTransformBench::WriteJson(jsonPath))
+	{
+		fprintf(stderr, "Could not write %s\n", jsonPath);
+		return 1;
+	}
+	return 0;
+}
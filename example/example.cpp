@@ -2,32 +2,420 @@
 //! @file 			example.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @created 		2014/01/21
-//! @last-modified 	2014/01/21
-//! @brief 			Example Park transform program, designed to be run on Linux.
+//! @last-modified 	2026/10/17
+//! @brief 			Command line Park transform tool, designed to be run on Linux.
 //! @details
 //!					See README.rst in root dir for more info.
+//!					Reads samples from the given files (or stdin), as CSV or raw binary, runs them
+//!					through the batch transforms and writes the results to stdout. Run with --help
+//!					for the options. Parsing and formatting use std::from_chars()/std::to_chars() on
+//!					fixed buffers, so nothing is allocated per sample.
 
+#include <charconv>
 #include <stdio.h>
-#include <iostream>
-#include <string>
+#include <string.h>
 
 #include "../api/ParkTransform.hpp"
 
+using namespace ParkTransform;
 
-using namespace std;
+//===============================================================================================//
+//========================================== OPTIONS ============================================//
+//===============================================================================================//
 
+enum class Mode
+{
+	FORWARD,	//!< alpha, beta, theta -> d, q
+	INVERSE,	//!< d, q, theta -> alpha, beta
+	ABC			//!< a, b, c, theta -> d, q, zero
+};
+
+enum class Format
+{
+	CSV,		//!< One sample per line, comma separated. Blank lines, '#' comments and a header line before the first sample are skipped.
+	BINARY		//!< Native-endian doubles, one sample after another
+};
+
+struct Options
+{
+	Mode mode;
+	Format inFormat;
+	Format outFormat;
+};
+
+static void PrintUsage(const char *name)
+{
+	fprintf(stderr,
+		"Usage: %s [options] [file ...]\n"
+		"Park transforms samples from the files, or stdin if none, to stdout.\n"
+		"  --mode forward|inverse|abc   forward: alpha,beta,theta -> d,q (default)\n"
+		"                               inverse: d,q,theta -> alpha,beta\n"
+		"                               abc:     a,b,c,theta -> d,q,zero\n"
+		"  --in csv|bin                 input format (default csv)\n"
+		"  --out csv|bin                output format (default csv)\n"
+		"bin is raw native-endian doubles, one sample's values after another.\n",
+		name);
+}
+
+//! Number of values in each input sample
+static int NumInputs(Mode mode)
+{
+	return (mode == Mode::ABC) ? 4 : 3;
+}
+
+//! Number of values in each output sample
+static int NumOutputs(Mode mode)
+{
+	return (mode == Mode::ABC) ? 3 : 2;
+}
+
+//===============================================================================================//
+//=========================================== OUTPUT ============================================//
+//===============================================================================================//
+
+//! Buffered stdout, flushed a whole buffer at a time
+class Output
+{
+public:
+	Output() : _size(0), _failed(false) {}
+
+	void PutCsv(const double *values, int numValues)
+	{
+		// Enough for numValues shortest round-trip doubles, separators and the newline
+		if(_size + numValues*maxCharsPerValue + 1 > bufferSize)
+			Flush();
+		char *pos = &_buffer[_size];
+		for(int i = 0; i < numValues; i++)
+		{
+			if(i > 0)
+				*pos++ = ',';
+			pos = std::to_chars(pos, &_buffer[bufferSize], values[i]).ptr;
+		}
+		*pos++ = '\n';
+		_size = pos - _buffer;
+	}
 
-int main()
+	void PutBinary(const double *values, int numValues)
+	{
+		size_t numBytes = numValues*sizeof(double);
+		if(_size + numBytes > bufferSize)
+			Flush();
+		memcpy(&_buffer[_size], values, numBytes);
+		_size += numBytes;
+	}
+
+	//! Returns false if any write failed
+	bool Flush()
+	{
+		if(_size > 0 && fwrite(_buffer, 1, _size, stdout) != _size)
+			_failed = true;
+		_size = 0;
+		return !_failed;
+	}
+
+private:
+	static const size_t bufferSize = 1 << 20;
+	static const int maxCharsPerValue = 32;
+
+	char _buffer[bufferSize];
+	size_t _size;
+	bool _failed;
+};
+
+//===============================================================================================//
+//========================================== BATCHES ============================================//
+//===============================================================================================//
+
+//! Collects samples into arrays and runs the batch transform on each full batch
+class Batcher
 {
-	
+public:
+	Batcher(const Options &options, Output &output) : _options(options), _output(output), _numSamples(0) {}
+
+	void Add(const double *values)
+	{
+		for(int i = 0; i < NumInputs(_options.mode); i++)
+			_in[i][_numSamples] = values[i];
+		if(++_numSamples == batchSize)
+			Flush();
+	}
 
-	while(1)
+	void Flush()
 	{
-		char inputMsg[30];
+		double *theta = _in[NumInputs(_options.mode) - 1];
+		switch(_options.mode)
+		{
+			case Mode::FORWARD:
+				_transformer.ForwardBatch(_in[0], _in[1], theta, _out[0], _out[1], _numSamples);
+				break;
+			case Mode::INVERSE:
+				_transformer.InverseBatch(_in[0], _in[1], theta, _out[0], _out[1], _numSamples);
+				break;
+			case Mode::ABC:
+				_transformer.ForwardFromABCBatch(_in[0], _in[1], _in[2], theta, _out[0], _out[1], _out[2], _numSamples);
+				break;
+		}
+
+		const int numOutputs = NumOutputs(_options.mode);
+		for(size_t i = 0; i < _numSamples; i++)
+		{
+			double values[3];
+			for(int k = 0; k < numOutputs; k++)
+				values[k] = _out[k][i];
+			if(_options.outFormat == Format::CSV)
+				_output.PutCsv(values, numOutputs);
+			else
+				_output.PutBinary(values, numOutputs);
+		}
+		_numSamples = 0;
+	}
+
+private:
+	static const size_t batchSize = 4096;
 
-		cin.get(inputMsg, 30);
-		cin.ignore();
+	const Options &_options;
+	Output &_output;
+	Transformer _transformer;
+	double _in[4][batchSize];
+	double _out[3][batchSize];
+	size_t _numSamples;
+};
 
-		// Add processing here to call a Park transformer and display the results...
+//===============================================================================================//
+//=========================================== INPUT =============================================//
+//===============================================================================================//
+
+static const size_t readBufferSize = 1 << 20;
+static char _readBuffer[readBufferSize];
+
+//! Parses numValues comma separated numbers. Returns false if the line is anything else.
+static bool ParseCsvValues(const char *pos, const char *end, int numValues, double *values)
+{
+	for(int i = 0; i < numValues; i++)
+	{
+		while(pos < end && (*pos == ' ' || *pos == '\t'))
+			pos++;
+		// from_chars doesn't accept a leading '+'
+		if(pos < end && *pos == '+')
+			pos++;
+		std::from_chars_result result = std::from_chars(pos, end, values[i]);
+		if(result.ec != std::errc())
+			return false;
+		pos = result.ptr;
+		while(pos < end && (*pos == ' ' || *pos == '\t' || *pos == '\r'))
+			pos++;
+		if(i + 1 < numValues)
+		{
+			if(pos == end || *pos != ',')
+				return false;
+			pos++;
+		}
+	}
+	return pos == end;
+}
+
+//! Parses one CSV line (without its newline). Returns 1 for a sample, 0 for a line to skip
+//! and -1 for an error. A line that isn't numbers is taken as a header (e.g.
+//! "alpha,beta,theta") if *allowHeader, which is cleared by the first header or sample.
+static int ParseCsvLine(const char *line, const char *end, int numValues, bool *allowHeader, double *values)
+{
+	const char *pos = line;
+	while(pos < end && (*pos == ' ' || *pos == '\t' || *pos == '\r'))
+		pos++;
+	if(pos == end || *pos == '#')
+		return 0;
+
+	// Numbers first, so a first sample of e.g. "nan,0,0" isn't mistaken for a header
+	bool isHeader = !ParseCsvValues(pos, end, numValues, values);
+	if(isHeader && !(*allowHeader && ((*pos >= 'a' && *pos <= 'z') || (*pos >= 'A' && *pos <= 'Z'))))
+		return -1;
+	*allowHeader = false;
+	return isHeader ? 0 : 1;
+}
+
+//! Returns false on a parse error, which has been reported
+static bool ReadCsv(FILE *file, const char *name, int numValues, Batcher &batcher)
+{
+	size_t numBuffered = 0;
+	unsigned long lineNumber = 0;
+	bool isEof = false;
+	// One header, before the first sample (comment and blank lines may come first)
+	bool allowHeader = true;
+
+	while(!isEof)
+	{
+		size_t numRead = fread(&_readBuffer[numBuffered], 1, readBufferSize - numBuffered, file);
+		numBuffered += numRead;
+		isEof = (numRead == 0);
+
+		const char *pos = _readBuffer;
+		const char *end = _readBuffer + numBuffered;
+		for(;;)
+		{
+			const char *newline = (const char *)memchr(pos, '\n', end - pos);
+			if(!newline)
+			{
+				// The last line may have no newline
+				if(!isEof || pos == end)
+					break;
+				newline = end;
+			}
+
+			lineNumber++;
+			double values[4];
+			int result = ParseCsvLine(pos, newline, numValues, &allowHeader, values);
+			if(result < 0)
+			{
+				fprintf(stderr, "%s:%lu: expected %d comma separated numbers\n", name, lineNumber, numValues);
+				return false;
+			}
+			if(result > 0)
+				batcher.Add(values);
+			pos = (newline < end) ? newline + 1 : end;
+		}
+
+		// Keep the partial line for the next read
+		numBuffered = end - pos;
+		if(numBuffered == readBufferSize)
+		{
+			fprintf(stderr, "%s:%lu: line too long\n", name, lineNumber + 1);
+			return false;
+		}
+		memmove(_readBuffer, pos, numBuffered);
+	}
+	return true;
+}
+
+//! Returns false if the input ends part way through a sample
+static bool ReadBinary(FILE *file, const char *name, int numValues, Batcher &batcher)
+{
+	const size_t sampleSize = numValues*sizeof(double);
+	size_t numBuffered = 0;
+
+	for(;;)
+	{
+		size_t numRead = fread(&_readBuffer[numBuffered], 1, readBufferSize - numBuffered, file);
+		numBuffered += numRead;
+		if(numRead == 0)
+			break;
+
+		size_t numSamples = numBuffered/sampleSize;
+		for(size_t i = 0; i < numSamples; i++)
+		{
+			double values[4];
+			memcpy(values, &_readBuffer[i*sampleSize], sampleSize);
+			batcher.Add(values);
+		}
+		numBuffered -= numSamples*sampleSize;
+		memmove(_readBuffer, &_readBuffer[numSamples*sampleSize], numBuffered);
+	}
+
+	if(numBuffered != 0)
+	{
+		fprintf(stderr, "%s: ends part way through a sample\n", name);
+		return false;
+	}
+	return true;
+}
+
+//===============================================================================================//
+//============================================ MAIN =============================================//
+//===============================================================================================//
+
+// Large, so static rather than on the stack
+static Output _output;
+
+int main(int argc, char **argv)
+{
+	Options options = { Mode::FORWARD, Format::CSV, Format::CSV };
+	const char *files[256];
+	int numFiles = 0;
+
+	for(int i = 1; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		const char *value = (i + 1 < argc) ? argv[i + 1] : "";
+		if(!strcmp(arg, "--mode"))
+		{
+			i++;
+			if(!strcmp(value, "forward"))
+				options.mode = Mode::FORWARD;
+			else if(!strcmp(value, "inverse"))
+				options.mode = Mode::INVERSE;
+			else if(!strcmp(value, "abc"))
+				options.mode = Mode::ABC;
+			else
+			{
+				PrintUsage(argv[0]);
+				return 2;
+			}
+		}
+		else if(!strcmp(arg, "--in") || !strcmp(arg, "--out"))
+		{
+			i++;
+			Format &format = !strcmp(arg, "--in") ? options.inFormat : options.outFormat;
+			if(!strcmp(value, "csv"))
+				format = Format::CSV;
+			else if(!strcmp(value, "bin"))
+				format = Format::BINARY;
+			else
+			{
+				PrintUsage(argv[0]);
+				return 2;
+			}
+		}
+		else if(!strcmp(arg, "--help") || !strcmp(arg, "-h"))
+		{
+			PrintUsage(argv[0]);
+			return 0;
+		}
+		else if(arg[0] == '-' && arg[1] != '\0')
+		{
+			PrintUsage(argv[0]);
+			return 2;
+		}
+		else if(numFiles < (int)(sizeof(files)/sizeof(files[0])))
+			files[numFiles++] = arg;
+		else
+		{
+			fprintf(stderr, "Too many files\n");
+			return 2;
+		}
+	}
+
+	// "-", or no files at all, is stdin
+	if(numFiles == 0)
+		files[numFiles++] = "-";
+
+	static Batcher batcher(options, _output);
+	bool ok = true;
+	for(int i = 0; i < numFiles && ok; i++)
+	{
+		bool isStdin = !strcmp(files[i], "-");
+		FILE *file = isStdin ? stdin : fopen(files[i], "rb");
+		if(!file)
+		{
+			perror(files[i]);
+			ok = false;
+			break;
+		}
+
+		const char *name = isStdin ? "stdin" : files[i];
+		if(options.inFormat == Format::CSV)
+			ok = ReadCsv(file, name, NumInputs(options.mode), batcher);
+		else
+			ok = ReadBinary(file, name, NumInputs(options.mode), batcher);
+
+		if(!isStdin)
+			fclose(file);
+	}
+
+	// Whatever was transformed before any error is still written
+	batcher.Flush();
+	if(!_output.Flush() || fflush(stdout) != 0)
+	{
+		perror("stdout");
+		return 1;
 	}
+	return ok ? 0 : 1;
 }
@@ -0,0 +1,152 @@
+//!
+//! @file 			AnglePolicies.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Angle policies for BasicTransformer, which define how theta is represented.
+//! @details
+//!					Each policy provides:
+//!						typedef ... angle_type
+//!						static ... ToRadians(angle_type theta)		(float or double)
+//!						static Bam32 ToBam32(angle_type theta)
+//!						static angle_type Difference(angle_type to, angle_type from)	(to - from)
+//!						template <class Lut, LutInterpolation interpolation>
+//!						static void LutSinCos(angle_type theta, int32_t *sinOut, int32_t *cosOut)
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_ANGLE_POLICIES_H
+#define PARK_TRANSFORM_ANGLE_POLICIES_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>
+
+// User includes
+#include "BinaryAngle.hpp"
+#include "Scalar.hpp"
+#include "SinCosLut.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		theta in radians, stored as A (float or double).
+	template <typename A>
+	struct RadianAngle
+	{
+		typedef A angle_type;
+
+		static A ToRadians(A theta)
+		{
+			return theta;
+		}
+
+		static Bam32 ToBam32(A theta)
+		{
+			return Bam32::FromRadians(theta);
+		}
+
+		static A Difference(A to, A from)
+		{
+			return to - from;
+		}
+
+		template <class Lut, LutInterpolation interpolation>
+		static void LutSinCos(A theta, int32_t *sinOut, int32_t *cosOut)
+		{
+			ParkTransform::LutSinCos<Lut, interpolation>(ToBam32(theta), sinOut, cosOut);
+		}
+	};
+
+	//! @brief		theta as a binary angle (fraction of a turn), BinaryAngle<U>.
+	//! @details	Needs a power-of-two LUT size for the LUT trig policy.
+	template <typename U>
+	struct BamAngle
+	{
+		typedef BinaryAngle<U> angle_type;
+
+		static double ToRadians(angle_type theta)
+		{
+			return theta.ToRadians();
+		}
+
+		static Bam32 ToBam32(angle_type theta)
+		{
+			return Bam32(theta);
+		}
+
+		//! Wraps for free
+		static angle_type Difference(angle_type to, angle_type from)
+		{
+			return to - from;
+		}
+
+		template <class Lut, LutInterpolation interpolation>
+		static void LutSinCos(angle_type theta, int32_t *sinOut, int32_t *cosOut)
+		{
+			ParkTransform::LutSinCos<Lut, interpolation>(theta, sinOut, cosOut);
+		}
+	};
+
+	//! @brief		theta measured in LUT entries (lutSize entries is one full turn), stored in the
+	//!				fixed-point type A. This is how the original fixed-point Transformer functions
+	//!				take theta.
+	template <typename A, uint32_t lutSize>
+	struct LutPositionAngle
+	{
+		typedef A angle_type;
+
+		static double ToRadians(A theta)
+		{
+			return ScalarTraits<A>::ToDouble(theta)*(2.0*LutMaths::pi/(double)lutSize);
+		}
+
+		static Bam32 ToBam32(A theta)
+		{
+			// Integer only (a shift when lutSize is a power of two), so no FPU is needed
+			const int64_t rawPerTurn = (int64_t)lutSize << ScalarTraits<A>::numFracBits;
+			int64_t raw = ScalarTraits<A>::Raw(theta) % rawPerTurn;
+			if(raw < 0)
+				raw += rawPerTurn;
+			return Bam32((uint32_t)(((uint64_t)raw << 32)/(uint64_t)rawPerTurn));
+		}
+
+		//! Wrapped to [0, lutSize), so it can't saturate when theta can hold a position
+		static A Difference(A to, A from)
+		{
+			const int64_t rawPerTurn = (int64_t)lutSize << ScalarTraits<A>::numFracBits;
+			int64_t raw = ((int64_t)ScalarTraits<A>::Raw(to) - ScalarTraits<A>::Raw(from)) % rawPerTurn;
+			if(raw < 0)
+				raw += rawPerTurn;
+			return ScalarTraits<A>::FromRaw((int32_t)raw, ScalarTraits<A>::numFracBits);
+		}
+
+		template <class Lut, LutInterpolation interpolation>
+		static void LutSinCos(A theta, int32_t *sinOut, int32_t *cosOut)
+		{
+			static_assert(Lut::numEntries == lutSize, "theta must be measured in entries of the same LUT.");
+			ParkTransform::LutSinCos<Lut, ScalarTraits<A>::numFracBits, interpolation>(
+				ScalarTraits<A>::Raw(theta), sinOut, cosOut);
+		}
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_ANGLE_POLICIES_H
+
+// EOF
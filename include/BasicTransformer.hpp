@@ -0,0 +1,338 @@
+//!
+//! @file 			BasicTransformer.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Header-only Park transformer, templated over the scalar type, angle
+//!					representation and trig implementation.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_BASIC_TRANSFORMER_H
+#define PARK_TRANSFORM_BASIC_TRANSFORMER_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stddef.h>		// size_t
+
+// User includes
+#include "AnglePolicies.hpp"
+#include "Frames.hpp"
+#include "Rotation.hpp"
+#include "Scalar.hpp"
+#include "Svpwm.hpp"
+#include "Trace.hpp"
+#include "TrigPolicies.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Park transformer for any scalar type, with everything inline in this header.
+	//! @details	T is the scalar type: float, double, Q15, Q31 (see Scalar.hpp), or Fp::fp<p>.
+	//!				AnglePolicy defines what theta is (see AnglePolicies.hpp), and TrigPolicy how
+	//!				sin/cos are evaluated (see TrigPolicies.hpp). Each combination is its own fully
+	//!				inlinable kernel, so e.g. a float build never touches double.
+	//!				If TrigPolicy rotates vectors itself (CordicTrig with fixed-point T), Forward()
+	//!				and Inverse() of an angle do so, while the Rotation overloads multiply by
+	//!				CalcRotation()'s sin/cos, so the two can differ by a few LSB's. With every other
+	//!				policy they are bit-exact.
+	//!				TracePolicy is told about each call that takes an angle (see Trace.hpp). The
+	//!				default, NullTrace, compiles to nothing.
+	//!				All functions are static and thread-safe.
+	//!
+	//!				Examples:
+	//!					BasicTransformer<float, RadianAngle<float>, LibmTrig>
+	//!					BasicTransformer<Q15, BamAngle<uint16_t>, LutTrig<SinCosLut<256, 15>, LutInterpolation::LINEAR> >
+	template <typename T, class AnglePolicy = RadianAngle<T>, class TrigPolicy = LibmTrig,
+		class TracePolicy = NullTrace>
+	class BasicTransformer
+	{
+
+	public:
+
+		typedef T scalar_type;
+		typedef typename AnglePolicy::angle_type angle_type;
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		//! @brief 		Calculates cos(theta) and sin(theta) once, for re-use across many calls.
+		static Rotation<T> CalcRotation(angle_type theta)
+		{
+			TracePolicy::template OnAngle<AnglePolicy>(theta);
+			return TrigPolicy::template CalcRotation<T, AnglePolicy>(theta);
+		}
+
+		//! @brief 		Converts from stationary alpha-beta to rotating d-q reference frame.
+		//! @details	d = alpha*cos(theta) + beta*sin(theta)
+		//!				q = beta*cos(theta) - alpha*sin(theta)
+		static void Forward(T alpha, T beta, const Rotation<T> &rotation, T *d, T *q)
+		{
+			typedef ScalarTraits<T> S;
+			*d = S::Add(S::Mul(alpha, rotation.cosTheta), S::Mul(beta, rotation.sinTheta));
+			*q = S::Sub(S::Mul(beta, rotation.cosTheta), S::Mul(alpha, rotation.sinTheta));
+		}
+
+		//! @brief 		Converts from stationary alpha-beta to rotating d-q reference frame.
+		static void Forward(T alpha, T beta, angle_type theta, T *d, T *q)
+		{
+			typename TracePolicy::Scope scope(TraceEvent::FORWARD);
+			Rotate(alpha, beta, theta, false, d, q, TrigRotatesVector<TrigPolicy, T>());
+		}
+
+		//! @brief 		Converts from rotating d-q reference frame to stationary alpha-beta.
+		//! @details	alpha = d*cos(theta) - q*sin(theta)
+		//!				beta  = q*cos(theta) + d*sin(theta)
+		static void Inverse(T d, T q, const Rotation<T> &rotation, T *alpha, T *beta)
+		{
+			typedef ScalarTraits<T> S;
+			*alpha = S::Sub(S::Mul(d, rotation.cosTheta), S::Mul(q, rotation.sinTheta));
+			*beta = S::Add(S::Mul(q, rotation.cosTheta), S::Mul(d, rotation.sinTheta));
+		}
+
+		//! @brief 		Converts from rotating d-q reference frame to stationary alpha-beta.
+		static void Inverse(T d, T q, angle_type theta, T *alpha, T *beta)
+		{
+			typename TracePolicy::Scope scope(TraceEvent::INVERSE);
+			Rotate(d, q, theta, true, alpha, beta, TrigRotatesVector<TrigPolicy, T>());
+		}
+
+		//! @brief 		Forward(), returning d and q by value. constexpr for float and double.
+		static constexpr Dq<T> Forward(T alpha, T beta, const Rotation<T> &rotation)
+		{
+			return Dq<T>{
+				ScalarTraits<T>::Add(ScalarTraits<T>::Mul(alpha, rotation.cosTheta), ScalarTraits<T>::Mul(beta, rotation.sinTheta)),
+				ScalarTraits<T>::Sub(ScalarTraits<T>::Mul(beta, rotation.cosTheta), ScalarTraits<T>::Mul(alpha, rotation.sinTheta)) };
+		}
+
+		//! @brief 		Forward(), returning d and q by value.
+		static Dq<T> Forward(T alpha, T beta, angle_type theta)
+		{
+			typename TracePolicy::Scope scope(TraceEvent::FORWARD);
+			Dq<T> dq;
+			Rotate(alpha, beta, theta, false, &dq.d, &dq.q, TrigRotatesVector<TrigPolicy, T>());
+			return dq;
+		}
+
+		//! @brief 		Inverse(), returning alpha and beta by value. constexpr for float and double.
+		static constexpr AlphaBeta<T> Inverse(T d, T q, const Rotation<T> &rotation)
+		{
+			return AlphaBeta<T>{
+				ScalarTraits<T>::Sub(ScalarTraits<T>::Mul(d, rotation.cosTheta), ScalarTraits<T>::Mul(q, rotation.sinTheta)),
+				ScalarTraits<T>::Add(ScalarTraits<T>::Mul(q, rotation.cosTheta), ScalarTraits<T>::Mul(d, rotation.sinTheta)) };
+		}
+
+		//! @brief 		Inverse(), returning alpha and beta by value.
+		static AlphaBeta<T> Inverse(T d, T q, angle_type theta)
+		{
+			typename TracePolicy::Scope scope(TraceEvent::INVERSE);
+			AlphaBeta<T> ab;
+			Rotate(d, q, theta, true, &ab.alpha, &ab.beta, TrigRotatesVector<TrigPolicy, T>());
+			return ab;
+		}
+
+		//! @brief 		Converts three-phase quantities straight to the rotating d-q-0 frame.
+		//! @details	Fuses the (amplitude-invariant) Clarke transform into Forward(), so alpha and
+		//!				beta are never stored:
+		//!					alpha = (2/3)*a - (1/3)*b - (1/3)*c
+		//!					beta  = (b - c)/sqrt(3)
+		//!					zero  = (a + b + c)/3
+		//!				Each term is scaled before summing, so Q15/Q31 inputs only saturate if the
+		//!				result itself is out of range.
+		static Dq0<T> ForwardFromABC(T a, T b, T c, const Rotation<T> &rotation)
+		{
+			typedef ScalarTraits<T> S;
+			const T oneThird = S::FromDouble(1.0/3.0);
+			const T twoThirds = S::FromDouble(2.0/3.0);
+			const T invSqrt3 = S::FromDouble(0.57735026918962576451);
+
+			T alpha = S::Sub(S::Sub(S::Mul(a, twoThirds), S::Mul(b, oneThird)), S::Mul(c, oneThird));
+			T beta = S::Sub(S::Mul(b, invSqrt3), S::Mul(c, invSqrt3));
+			Dq<T> dq = Forward(alpha, beta, rotation);
+			return Dq0<T>{ dq.d, dq.q,
+				S::Add(S::Add(S::Mul(a, oneThird), S::Mul(b, oneThird)), S::Mul(c, oneThird)) };
+		}
+
+		//! @brief 		Converts three-phase quantities straight to the rotating d-q-0 frame.
+		static Dq0<T> ForwardFromABC(T a, T b, T c, angle_type theta)
+		{
+			typename TracePolicy::Scope scope(TraceEvent::FORWARD_FROM_ABC);
+			return ForwardFromABC(a, b, c, CalcRotation(theta));
+		}
+
+		//! @brief 		ForwardFromABC() for two phase sensors, with c = -a - b (so zero = 0).
+		//! @details	alpha = a
+		//!				beta  = (a + 2b)/sqrt(3)
+		static Dq<T> ForwardFromAB(T a, T b, const Rotation<T> &rotation)
+		{
+			typedef ScalarTraits<T> S;
+			const T invSqrt3 = S::FromDouble(0.57735026918962576451);
+
+			T bScaled = S::Mul(b, invSqrt3);
+			T beta = S::Add(S::Add(S::Mul(a, invSqrt3), bScaled), bScaled);
+			return Forward(a, beta, rotation);
+		}
+
+		//! @brief 		ForwardFromABC() for two phase sensors, with c = -a - b (so zero = 0).
+		static Dq<T> ForwardFromAB(T a, T b, angle_type theta)
+		{
+			typename TracePolicy::Scope scope(TraceEvent::FORWARD_FROM_ABC);
+			return ForwardFromAB(a, b, CalcRotation(theta));
+		}
+
+		//! @brief 		Inverse() followed by space-vector PWM, giving the three phase duty cycles.
+		//! @details	d and q are normalised to the DC link voltage. See SvpwmDuties().
+		static Abc<T> InverseSvpwm(T d, T q, const Rotation<T> &rotation)
+		{
+			AlphaBeta<T> ab = Inverse(d, q, rotation);
+			return SvpwmDuties(ab.alpha, ab.beta);
+		}
+
+		//! @brief 		The rotation by (to - from), from two precomputed rotations, with no trig.
+		//! @details	cos(to - from) = cos(to)*cos(from) + sin(to)*sin(from)
+		//!				sin(to - from) = sin(to)*cos(from) - cos(to)*sin(from)
+		static Rotation<T> RelativeRotation(const Rotation<T> &from, const Rotation<T> &to)
+		{
+			typedef ScalarTraits<T> S;
+			return Rotation<T>(
+				S::Add(S::Mul(to.cosTheta, from.cosTheta), S::Mul(to.sinTheta, from.sinTheta)),
+				S::Sub(S::Mul(to.sinTheta, from.cosTheta), S::Mul(to.cosTheta, from.sinTheta)));
+		}
+
+		//! @brief 		Re-references d-q from the frame at thetaFrom to the frame at thetaTo.
+		//! @details	The same as Inverse() at thetaFrom then Forward() at thetaTo, but as one
+		//!				rotation by thetaTo - thetaFrom, so with one sin/cos and 4 multiplies instead
+		//!				of two and 8. Use Forward() with RelativeRotation() when both rotations are
+		//!				already known.
+		static void Reframe(T d, T q, angle_type thetaFrom, angle_type thetaTo, T *dOut, T *qOut)
+		{
+			typename TracePolicy::Scope scope(TraceEvent::REFRAME);
+			Forward(d, q, CalcRotation(AnglePolicy::Difference(thetaTo, thetaFrom)), dOut, qOut);
+		}
+
+		//! @brief 		Reframe(), returning d and q by value.
+		static Dq<T> Reframe(T d, T q, angle_type thetaFrom, angle_type thetaTo)
+		{
+			Dq<T> dq;
+			Reframe(d, q, thetaFrom, thetaTo, &dq.d, &dq.q);
+			return dq;
+		}
+
+		//! @brief 		Inverse() followed by space-vector PWM, giving the three phase duty cycles.
+		static Abc<T> InverseSvpwm(T d, T q, angle_type theta)
+		{
+			typename TracePolicy::Scope scope(TraceEvent::INVERSE_SVPWM);
+			return InverseSvpwm(d, q, CalcRotation(theta));
+		}
+
+		//! @brief 		Forward() over arrays. d may alias alpha and q may alias beta.
+		static void ForwardBatch(const T *alpha, const T *beta, const angle_type *theta,
+			T *d, T *q, size_t numSamples)
+		{
+			for(size_t i = 0; i < numSamples; i++)
+				Forward(alpha[i], beta[i], theta[i], &d[i], &q[i]);
+		}
+
+		//! @brief 		Inverse() over arrays. alpha may alias d and beta may alias q.
+		static void InverseBatch(const T *d, const T *q, const angle_type *theta,
+			T *alpha, T *beta, size_t numSamples)
+		{
+			for(size_t i = 0; i < numSamples; i++)
+				Inverse(d[i], q[i], theta[i], &alpha[i], &beta[i]);
+		}
+
+		//! @brief 		ForwardFromABC() over arrays. zero may be NULL if it is not needed.
+		//!				Outputs may alias inputs.
+		static void ForwardFromABCBatch(const T *a, const T *b, const T *c, const angle_type *theta,
+			T *d, T *q, T *zero, size_t numSamples)
+		{
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				Dq0<T> dq0 = ForwardFromABC(a[i], b[i], c[i], theta[i]);
+				d[i] = dq0.d;
+				q[i] = dq0.q;
+				if(zero)
+					zero[i] = dq0.zero;
+			}
+		}
+
+		//! @brief 		InverseSvpwm() over arrays. Outputs may alias inputs.
+		static void InverseSvpwmBatch(const T *d, const T *q, const angle_type *theta,
+			T *dutyA, T *dutyB, T *dutyC, size_t numSamples)
+		{
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				Abc<T> duties = InverseSvpwm(d[i], q[i], theta[i]);
+				dutyA[i] = duties.a;
+				dutyB[i] = duties.b;
+				dutyC[i] = duties.c;
+			}
+		}
+
+		//! @brief 		Reframe() over arrays. dOut may alias d and qOut may alias q.
+		static void ReframeBatch(const T *d, const T *q, const angle_type *thetaFrom, const angle_type *thetaTo,
+			T *dOut, T *qOut, size_t numSamples)
+		{
+			for(size_t i = 0; i < numSamples; i++)
+				Reframe(d[i], q[i], thetaFrom[i], thetaTo[i], &dOut[i], &qOut[i]);
+		}
+
+		//! @brief 		ForwardFromAB() over arrays. Outputs may alias inputs.
+		static void ForwardFromABBatch(const T *a, const T *b, const angle_type *theta,
+			T *d, T *q, size_t numSamples)
+		{
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				Dq<T> dq = ForwardFromAB(a[i], b[i], theta[i]);
+				d[i] = dq.d;
+				q[i] = dq.q;
+			}
+		}
+
+	private:
+
+		//===============================================================================================//
+		//======================================= PRIVATE METHODS =======================================//
+		//===============================================================================================//
+
+		//! Rotates (x, y) by -theta (Forward()) or theta (Inverse()), via sin/cos and four multiplies
+		static void Rotate(T x, T y, angle_type theta, bool inverse, T *xOut, T *yOut, std::false_type)
+		{
+			Rotation<T> rotation = CalcRotation(theta);
+			if(inverse)
+				Inverse(x, y, rotation, xOut, yOut);
+			else
+				Forward(x, y, rotation, xOut, yOut);
+		}
+
+		//! The trig policy rotates (x, y) itself, e.g. CordicTrig with shifts and adds
+		static void Rotate(T x, T y, angle_type theta, bool inverse, T *xOut, T *yOut, std::true_type)
+		{
+			TracePolicy::template OnAngle<AnglePolicy>(theta);
+			TrigPolicy::template Rotate<T, AnglePolicy>(x, y, theta, inverse, xOut, yOut);
+		}
+
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_BASIC_TRANSFORMER_H
+
+// EOF
@@ -0,0 +1,117 @@
+//!
+//! @file 			BinaryAngle.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Binary angle measurement (BAM) type, an unsigned fraction of a full turn.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_BINARY_ANGLE_H
+#define PARK_TRANSFORM_BINARY_ANGLE_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>
+#include <math.h>
+#include <type_traits>
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		An angle stored as an unsigned fraction of a full turn (binary angle measurement).
+	//! @details	value/2^numBits turns, e.g. for BinaryAngle<uint16_t> 0x4000 is 90 degrees.
+	//!				Adding, subtracting and multiplying wrap for free with integer overflow, and a
+	//!				power-of-two LUT is indexed with just a shift. T must be uint16_t or uint32_t.
+	template <typename T>
+	class BinaryAngle
+	{
+
+		static_assert(T(-1) > T(0), "BinaryAngle must use an unsigned type.");
+
+	public:
+
+		static constexpr uint8_t numBits = sizeof(T)*8;
+
+		constexpr BinaryAngle() :
+			value(0)
+		{}
+
+		constexpr explicit BinaryAngle(T value) :
+			value(value)
+		{}
+
+		//! @brief		Widens a narrower binary angle, e.g. BinaryAngle<uint16_t> to BinaryAngle<uint32_t>.
+		//!				Exact, so implicit.
+		template <typename U, typename = typename std::enable_if<(sizeof(U) < sizeof(T))>::type>
+		constexpr BinaryAngle(BinaryAngle<U> other) :
+			value((T)((T)other.value << (numBits - BinaryAngle<U>::numBits)))
+		{}
+
+		//! @brief		Converts from radians, rounding to the nearest step and wrapping into one turn.
+		static BinaryAngle FromRadians(double radians)
+		{
+			double turns = radians/(2.0*3.14159265358979323846);
+			turns -= floor(turns);
+			// Rounding up to a whole turn wraps to 0 in the cast
+			return BinaryAngle((T)(uint64_t)llround(turns*(double)((uint64_t)1 << numBits)));
+		}
+
+		//! @brief		Converts from an encoder count, with countsPerRev counts per turn.
+		//! @details	Exact (a shift) when countsPerRev is a power of two. count is wrapped.
+		static constexpr BinaryAngle FromEncoder(uint32_t count, uint32_t countsPerRev)
+		{
+			return BinaryAngle((T)((((uint64_t)(count % countsPerRev)) << numBits)/countsPerRev));
+		}
+
+		//! @brief		Returns the angle in radians, in [0, 2*pi).
+		double ToRadians() const
+		{
+			return (double)value*(2.0*3.14159265358979323846/(double)((uint64_t)1 << numBits));
+		}
+
+		constexpr BinaryAngle operator+(BinaryAngle rhs) const { return BinaryAngle((T)(value + rhs.value)); }
+		constexpr BinaryAngle operator-(BinaryAngle rhs) const { return BinaryAngle((T)(value - rhs.value)); }
+		constexpr BinaryAngle operator-() const { return BinaryAngle((T)(0u - value)); }
+
+		//! @brief		Multiplies by an integer, e.g. mechanical angle * pole pairs = electrical angle.
+		constexpr BinaryAngle operator*(uint32_t rhs) const { return BinaryAngle((T)(value*rhs)); }
+
+		constexpr bool operator==(BinaryAngle rhs) const { return value == rhs.value; }
+		constexpr bool operator!=(BinaryAngle rhs) const { return value != rhs.value; }
+
+		//===============================================================================================//
+		//====================================== PUBLIC VARIABLES =======================================//
+		//===============================================================================================//
+
+		T value;
+
+	};
+
+	//! 16-bit binary angle, 65536 steps per turn
+	typedef BinaryAngle<uint16_t> Bam16;
+
+	//! 32-bit binary angle, 2^32 steps per turn
+	typedef BinaryAngle<uint32_t> Bam32;
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_BINARY_ANGLE_H
+
+// EOF
@@ -4,7 +4,7 @@
 //! @author 			Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @edited 			n/a
 //! @created			2014/01/21
-//! @last-modified 		2014/01/21
+//! @last-modified 		2026/10/17
 //! @brief 				Configuration file for park-transform-cpp library.
 //! @details
 //!						See the README in the repo root dir for more info.
@@ -20,17 +20,112 @@
 #ifndef PARK_TRANSFORM_CONFIG_H
 #define PARK_TRANSFORM_CONFIG_H
 
-//! @brief		Set to 1 to print debug messages
-#define config_PRINT_DEBUG_PARK_TRANSFORM		0
+// Each setting can also be overridden from the compiler command line (e.g. -DCDP=12)
 
-#define CDP				8
+#if defined(config_PRINT_DEBUG_PARK_TRANSFORM) && (config_PRINT_DEBUG_PARK_TRANSFORM == 1)
+	#error config_PRINT_DEBUG_PARK_TRANSFORM has been replaced by configPARK_TRACE (see TraceRecorder.hpp).
+#endif
 
-//! @brief		The size of the sine and cosine LUT's. A higher number gives higher precision but uses more memory (RAM).
-#define configPARK_LUT_SIZE					(255)
+#ifndef CDP
+	#define CDP				8
+#endif
+
+//! @brief		The size of the sine and cosine LUT's. A higher number gives higher precision but uses more memory.
+//! @note		The LUT's are generated at compile time and live in read-only memory (flash on most micros).
+//! @note		theta for the fixed-point functions is measured in LUT entries, so this sets its scale.
+//!				The default is the original 255. A power of two (e.g. 256) makes wrapping theta a mask,
+//!				and is required for the fixed-point binary angle (Bam16/Bam32) functions, which index
+//!				the LUT with a shift. They are left out for other sizes, unless configPARK_USE_CORDIC is 1.
+#ifndef configPARK_LUT_SIZE
+	#define configPARK_LUT_SIZE					(255)
+#endif
+
+//! @brief		Set to 1 to store a single quarter-wave sine table instead of full-wave sine and
+//!				cosine tables. Uses 8x less memory for the same resolution, at the cost of some index
+//!				folding per lookup. configPARK_LUT_SIZE must be a multiple of 4.
+#ifndef configPARK_LUT_QUARTER_WAVE
+	#define configPARK_LUT_QUARTER_WAVE			0
+#endif
+
+//! @brief		Set to 1 to linearly interpolate between adjacent LUT entries using the fractional
+//!				part of theta, instead of truncating theta to an entry. Gives close to sin() accuracy
+//!				from a small table, for two extra multiplies per lookup.
+#ifndef configPARK_LUT_INTERPOLATION
+	#define configPARK_LUT_INTERPOLATION		0
+#endif
+
+//! @brief		Set to 1 to calculate sin/cos for the fixed-point functions by CORDIC (see Cordic.hpp)
+//!				instead of from the LUT's. Uses no table RAM/flash apart from
+//!				4*configPARK_CORDIC_ITERATIONS bytes, and its accuracy is not capped by a table size.
+#ifndef configPARK_USE_CORDIC
+	#define configPARK_USE_CORDIC				0
+#endif
+
+//! @brief		CORDIC iterations, 1 to 30. Each adds roughly one bit of accuracy and a few cycles.
+#ifndef configPARK_CORDIC_ITERATIONS
+	#define configPARK_CORDIC_ITERATIONS		16
+#endif
 
 //! @brief		Set to 1 to enable fixed-point transform functions.
 //! @note		The fixed-point-cpp library is required.
-#define config_ENABLE_FIXED_POINT_FUNCTIONS		0
+#ifndef config_ENABLE_FIXED_POINT_FUNCTIONS
+	#define config_ENABLE_FIXED_POINT_FUNCTIONS		0
+#endif
+
+//! @brief		Set to 1 to define the double scalar Transformer methods inline in Transformer.hpp,
+//!				so calls from a control loop can be inlined. The batch and fixed-point methods are
+//!				still compiled into the library. Must be set the same way for every translation
+//!				unit, including the library build.
+#ifndef config_PARK_TRANSFORM_HEADER_ONLY
+	#define config_PARK_TRANSFORM_HEADER_ONLY		0
+#endif
+
+
+//! @brief		Set to 1 to record call counts, an angle histogram and sampled cycle counts from the
+//!				Transformer methods (see TraceRecorder.hpp). At 0 the trace hooks compile to nothing.
+#ifndef configPARK_TRACE
+	#define configPARK_TRACE					0
+#endif
+
+//! @brief		When tracing, one call in this many is timed with the cycle counter.
+#ifndef configPARK_TRACE_SAMPLE_INTERVAL
+	#define configPARK_TRACE_SAMPLE_INTERVAL	64
+#endif
+
+//! @brief		Number of bins (equal parts of a turn) in the traced angle histogram.
+#ifndef configPARK_TRACE_HISTOGRAM_BINS
+	#define configPARK_TRACE_HISTOGRAM_BINS		64
+#endif
+
+//! @brief		Cycle samples each thread can queue between drains. Must be a power of two.
+#ifndef configPARK_TRACE_RING_SIZE
+	#define configPARK_TRACE_RING_SIZE			256
+#endif
+
+//! @brief		Set to 1 to build TraceDrainThread, which needs std::thread. Set to 0 on targets
+//!				without it, and call DrainTrace() from a low priority task instead.
+#ifndef configPARK_TRACE_DRAIN_THREAD
+	#define configPARK_TRACE_DRAIN_THREAD		1
+#endif
+
+// configPARK_TRACE_READ_CYCLES() may be defined to read the cycle counter used for tracing,
+// e.g. DWT->CYCCNT on a Cortex-M. rdtsc (x86) and cntvct_el0 (AArch64) are used otherwise.
+
+//! @brief		Samples a ForwardStage can queue between Process() calls. Must be a power of two.
+#ifndef configPARK_STAGE_RING_SIZE
+	#define configPARK_STAGE_RING_SIZE			4096
+#endif
+
+//! @brief		Samples per chunk of work in ParallelTransformer. Five arrays of this many doubles
+//!				(160 kB at 4096) should fit in each core's L2 cache.
+#ifndef configPARK_PARALLEL_CHUNK_SIZE
+	#define configPARK_PARALLEL_CHUNK_SIZE		4096
+#endif
+
+//! @brief		Most samples in one block of a d-q log (DqLog.hpp), and so the decoder's output size.
+#ifndef configPARK_DQ_LOG_BLOCK_SIZE
+	#define configPARK_DQ_LOG_BLOCK_SIZE		4096
+#endif
 
 
 #endif // #define PARK_TRANSFORM_CONFIG_H
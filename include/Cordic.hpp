@@ -0,0 +1,234 @@
+//!
+//! @file 			Cordic.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Shift-and-add CORDIC rotation, vectoring and sin/cos, an alternative to the LUT's
+//!					for the fixed-point path.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_CORDIC_H
+#define PARK_TRANSFORM_CORDIC_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>
+
+// User includes
+#include "BinaryAngle.hpp"
+#include "SinCosLut.hpp"		// LutMaths
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	namespace CordicMaths
+	{
+		//! @brief		atan(x) for |x| <= 0.5, usable in constant expressions (Taylor series).
+		constexpr double Atan(double x)
+		{
+			double term = x;
+			double sum = x;
+			for(int n = 1; n < 40; n++)
+			{
+				term *= -x*x;
+				sum += term/(2.0*n + 1.0);
+			}
+			return sum;
+		}
+
+		//! @brief		sqrt(x) for x in [0.5, 2], usable in constant expressions (Newton's method).
+		constexpr double Sqrt(double x)
+		{
+			double root = 1.0;
+			for(int i = 0; i < 10; i++)
+				root = 0.5*(root + x/root);
+			return root;
+		}
+
+		//! @brief		atan(2^-i) as a 32-bit binary angle (2^32 per turn), rounded.
+		constexpr int32_t AtanBam(int i)
+		{
+			double radians = (i == 0) ? LutMaths::pi/4.0 : Atan(1.0/(double)((int64_t)1 << i));
+			return (int32_t)(radians/(2.0*LutMaths::pi)*4294967296.0 + 0.5);
+		}
+
+		//! @brief		1/(CORDIC gain) after numIterations iterations, i.e. prod 1/sqrt(1 + 4^-i).
+		constexpr double InvGain(int numIterations)
+		{
+			double invGain = 1.0;
+			for(int i = 0; i < numIterations; i++)
+				invGain /= Sqrt(1.0 + 1.0/(double)((int64_t)1 << (2*i)));
+			return invGain;
+		}
+	} // namespace CordicMaths
+
+	//! @brief		CORDIC with only shifts, adds and a table of numIterations atan(2^-i) constants
+	//!				(4 bytes each, built at compile time).
+	//! @details	Rotate() turns a vector by an angle (rotation mode), Vector() finds the angle and
+	//!				magnitude of a vector (vectoring mode), and SinCos() is Rotate() of (1, 0).
+	//!				Max error is about atan(2^-(numIterations - 1)) of the magnitude, i.e. each
+	//!				iteration adds one bit, until the rounding of the Q2.30 arithmetic takes over
+	//!				at around 26 iterations. Checked in test/CordicTests.cpp (SinCos()):
+	//!					numIterations =  8: < 8e-3
+	//!					numIterations = 16: < 3.1e-5
+	//!					numIterations = 24: < 1.5e-7
+	//!					numIterations = 30: < 2e-8
+	//!				The angle is first folded into [-90, 90] degrees, inside CORDIC's convergence range.
+	template <int numIterations>
+	struct Cordic
+	{
+		static_assert(numIterations >= 1 && numIterations <= 30, "numIterations must be 1 to 30.");
+
+		//! Fraction bits of the sin/cos outputs (Q2.30)
+		static constexpr uint8_t numFracBits = 30;
+
+		//! @brief		Calculates sin and cos of theta, as Q2.30.
+		static void SinCos(Bam32 theta, int32_t *sinOut, int32_t *cosOut)
+		{
+			// Fold into [-90, 90] degrees by rotating a half turn, and negating the result
+			int32_t z = (int32_t)theta.value;
+			bool negate = false;
+			if(z > (1 << 30) || z < -(1 << 30))
+			{
+				z = (int32_t)(theta.value + 0x80000000u);
+				negate = true;
+			}
+
+			// Start from (1/gain, 0), so the result comes out at unit magnitude
+			int32_t x = _invGain;
+			int32_t y = 0;
+			for(int i = 0; i < numIterations; i++)
+			{
+				// Branch-free: sign is 0 to rotate anticlockwise, -1 clockwise, and (v ^ sign) - sign
+				// negates v when sign is -1. The direction is data dependent, so a branch here
+				// would be mispredicted about half the time.
+				int32_t sign = z >> 31;
+				int32_t xShifted = x >> i;
+				int32_t yShifted = y >> i;
+				x -= (yShifted ^ sign) - sign;
+				y += (xShifted ^ sign) - sign;
+				z -= (_table.atanBam[i] ^ sign) - sign;
+			}
+
+			*cosOut = negate ? -x : x;
+			*sinOut = negate ? -y : y;
+		}
+
+		//! @brief		Rotates (x, y) anticlockwise by theta, with the iterations acting on the vector
+		//!				itself rather than on (1, 0).
+		//! @details	x and y are raw fixed-point values (any number of fraction bits, the same for
+		//!				both), and so are the rounded outputs. The outputs have the input's
+		//!				magnitude, which can be up to sqrt(2) times the largest int32_t.
+		//!				The CORDIC gain is compensated by scaling the input once, so this is two
+		//!				multiplies where sin/cos followed by a rotation is four. The iterations use
+		//!				int64_t, with guardBits extra fraction bits so the shifts don't lose precision.
+		static void Rotate(int32_t x, int32_t y, Bam32 theta, int64_t *xOut, int64_t *yOut)
+		{
+			int64_t xScaled = ((int64_t)x*_invGain) >> (numFracBits - guardBits);
+			int64_t yScaled = ((int64_t)y*_invGain) >> (numFracBits - guardBits);
+
+			// Fold into [-90, 90] degrees, a half turn is a negation
+			int32_t z = (int32_t)theta.value;
+			if(z > (1 << 30) || z < -(1 << 30))
+			{
+				z = (int32_t)(theta.value + 0x80000000u);
+				xScaled = -xScaled;
+				yScaled = -yScaled;
+			}
+
+			for(int i = 0; i < numIterations; i++)
+			{
+				// Branch-free, as in SinCos()
+				int64_t sign = z >> 31;
+				int64_t xShifted = xScaled >> i;
+				int64_t yShifted = yScaled >> i;
+				xScaled -= (yShifted ^ sign) - sign;
+				yScaled += (xShifted ^ sign) - sign;
+				z -= (_table.atanBam[i] ^ (int32_t)sign) - (int32_t)sign;
+			}
+
+			*xOut = (xScaled + ((int64_t)1 << (guardBits - 1))) >> guardBits;
+			*yOut = (yScaled + ((int64_t)1 << (guardBits - 1))) >> guardBits;
+		}
+
+		//! @brief		Vectoring mode: the angle atan2(y, x) and magnitude sqrt(x^2 + y^2) of (x, y).
+		//! @details	Rotates the vector onto the x axis, summing the angles it was turned by.
+		//!				x and y are raw fixed-point values, and magnitude is in the same units (it
+		//!				can't overflow, sqrt(2)*2^31 < 2^32). The angle of (0, 0) is undefined.
+		static void Vector(int32_t x, int32_t y, Bam32 *angle, uint32_t *magnitude)
+		{
+			int64_t xScaled = (int64_t)x << guardBits;
+			int64_t yScaled = (int64_t)y << guardBits;
+
+			// Fold the left half plane onto the right, inside the convergence range
+			uint32_t z = 0;
+			if(xScaled < 0)
+			{
+				xScaled = -xScaled;
+				yScaled = -yScaled;
+				z = 0x80000000u;
+			}
+
+			for(int i = 0; i < numIterations; i++)
+			{
+				// Turn towards the x axis: clockwise (sign 0) while y is positive
+				int64_t sign = yScaled >> 63;
+				int64_t xShifted = xScaled >> i;
+				int64_t yShifted = yScaled >> i;
+				xScaled += (yShifted ^ sign) - sign;
+				yScaled -= (xShifted ^ sign) - sign;
+				z += (uint32_t)((_table.atanBam[i] ^ (int32_t)sign) - (int32_t)sign);
+			}
+
+			// x grew by the CORDIC gain
+			*angle = Bam32(z);
+			*magnitude = (uint32_t)(((xScaled >> guardBits)*_invGain + ((int64_t)1 << (numFracBits - 1))) >> numFracBits);
+		}
+
+	private:
+
+		//! Extra fraction bits carried through Rotate() and Vector()
+		static const int guardBits = 16;
+
+		struct Table
+		{
+			int32_t atanBam[numIterations];
+
+			constexpr Table() :
+				atanBam()
+			{
+				for(int i = 0; i < numIterations; i++)
+					atanBam[i] = CordicMaths::AtanBam(i);
+			}
+		};
+
+		static constexpr Table _table = Table();
+		static constexpr int32_t _invGain = LutMaths::ToFixed(CordicMaths::InvGain(numIterations), numFracBits);
+
+	};
+
+	template <int numIterations>
+	constexpr typename Cordic<numIterations>::Table Cordic<numIterations>::_table;
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_CORDIC_H
+
+// EOF
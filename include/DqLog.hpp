@@ -0,0 +1,155 @@
+//!
+//! @file 			DqLog.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Compressed d-q logs, delta coded into variable-length integers.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_DQ_LOG_H
+#define PARK_TRANSFORM_DQ_LOG_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stddef.h>
+#include <stdint.h>
+
+// User includes
+#include "Config.hpp"
+#include "SampleFile.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Result of decoding part of a d-q log.
+	enum class DqLogStatus
+	{
+		OK,			//!< Decoded, numUsed bytes were consumed
+		NEED_MORE,	//!< The buffer ends part way through, call again with more bytes
+		END,		//!< The end marker, numUsed bytes were consumed
+		ERROR		//!< Not a d-q log, a version this can't read, a different type or corrupt. If
+					//!< only a block's payload is corrupt, numUsed is the block's size so it can be
+					//!< skipped, otherwise it is 0 and the rest of the log can't be read
+	};
+
+	//! @brief		The stream header.
+	struct DqLogHeader
+	{
+		SampleType type;
+		uint8_t cdp;			//!< Fraction bits of INT32 values, 0 for the float types
+		double sampleRate;		//!< In Hz, 0 if unknown
+	};
+
+	//! @brief		Encodes blocks of d and q into a compressed log.
+	//! @details	A log is a 24 byte header, then blocks, then an end marker. Each block is
+	//!				varint(numSamples), the payload size (4 bytes, little-endian), then the payload:
+	//!				the d values followed by the q values, each one a varint of its residual from
+	//!				the previous value of the same signal in the block, zigzag(x[i] - x[i - 1]).
+	//!				Floats are first mapped to integers in the same order (sign-magnitude to
+	//!				offset binary), so close values differ only in their low bits. An XOR of the
+	//!				raw bits was tried, but noise carrying into the upper mantissa bits made it
+	//!				about twice the size.
+	//!				It is lossless, so how small the residuals get depends on the type. For steady
+	//!				state d and q with a little noise (DqLogBench), INT32 values take about 1 byte
+	//!				(4x smaller) and FLOAT32 about 2.6 (1.5x), but the noise fills the low mantissa
+	//!				bits of FLOAT64, which still take about 6.8 (1.2x). Blocks don't depend on each
+	//!				other, so a block with a damaged payload loses only its own samples, and
+	//!				DecodeBlock() returns its size so it can be skipped. The end marker is a
+	//!				numSamples of 0.
+	//!				The encoder doesn't allocate, give it buffers of MaxBlockSize() bytes.
+	class DqLogEncoder
+	{
+
+	public:
+
+		static const size_t headerSize = 24;
+
+		//! @brief		Most bytes EncodeBlock() can write for numSamples samples.
+		static constexpr size_t MaxBlockSize(size_t numSamples)
+		{
+			return maxVarintSize + 4 + 2*numSamples*maxVarintSize;
+		}
+
+		DqLogEncoder(SampleType type, double sampleRate, uint8_t cdp = 0);
+
+		//! @brief		Writes the headerSize byte header. Returns the number of bytes written.
+		size_t EncodeHeader(uint8_t *out) const;
+
+		//! @brief		Writes one block of numSamples (1 to configPARK_DQ_LOG_BLOCK_SIZE) samples.
+		//!				Returns the number of bytes written, or 0 if the type isn't the log's type
+		//!				or numSamples is out of range.
+		size_t EncodeBlock(const double *d, const double *q, size_t numSamples, uint8_t *out) const;
+		size_t EncodeBlock(const float *d, const float *q, size_t numSamples, uint8_t *out) const;
+		size_t EncodeBlock(const int32_t *d, const int32_t *q, size_t numSamples, uint8_t *out) const;
+
+		//! @brief		Writes the end marker. Returns the number of bytes written.
+		size_t EncodeEnd(uint8_t *out) const;
+
+	private:
+
+		static const size_t maxVarintSize = 10;
+
+		template <typename T>
+		size_t Encode(const T *d, const T *q, size_t numSamples, uint8_t *out) const;
+
+		DqLogHeader _header;
+
+	};
+
+	//! @brief		Decodes a log from DqLogEncoder, from whatever bytes have arrived so far.
+	//! @details	Call DecodeHeader() then DecodeBlock() until it returns END, each time passing
+	//!				the bytes not yet used. NEED_MORE consumes nothing, so keep the bytes and call
+	//!				again once more have been read.
+	class DqLogDecoder
+	{
+
+	public:
+
+		DqLogDecoder();
+
+		DqLogStatus DecodeHeader(const uint8_t *in, size_t size, size_t *numUsed);
+
+		//! @brief		Valid after DecodeHeader() returns OK.
+		const DqLogHeader &GetHeader() const { return _header; }
+
+		//! @brief		Decodes one block into d and q, which must hold configPARK_DQ_LOG_BLOCK_SIZE
+		//!				samples. They must be of the log's type.
+		DqLogStatus DecodeBlock(const uint8_t *in, size_t size, double *d, double *q,
+			size_t *numSamples, size_t *numUsed) const;
+		DqLogStatus DecodeBlock(const uint8_t *in, size_t size, float *d, float *q,
+			size_t *numSamples, size_t *numUsed) const;
+		DqLogStatus DecodeBlock(const uint8_t *in, size_t size, int32_t *d, int32_t *q,
+			size_t *numSamples, size_t *numUsed) const;
+
+	private:
+
+		template <typename T>
+		DqLogStatus Decode(const uint8_t *in, size_t size, T *d, T *q, size_t *numSamples, size_t *numUsed) const;
+
+		DqLogHeader _header;
+		bool _hasHeader;
+
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_DQ_LOG_H
+
+// EOF
@@ -0,0 +1,134 @@
+//!
+//! @file 			ForwardStage.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Streaming stage between a producer thread (e.g. ADC acquisition) and a consumer
+//!					thread, which runs the batch Park transform on whatever has arrived.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_FORWARD_STAGE_H
+#define PARK_TRANSFORM_FORWARD_STAGE_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// User includes
+#include "Config.hpp"
+#include "SpscRing.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		One sample waiting in a ForwardStage.
+	struct StageSample
+	{
+		double alpha;
+		double beta;
+		double theta;
+		uint64_t timestampNs;		//!< When it was pushed, see StageNowNs()
+	};
+
+	//! @brief		Monotonic clock used for the ForwardStage latency, in nanoseconds.
+	uint64_t StageNowNs();
+
+	//! @brief		A snapshot of a ForwardStage's metrics.
+	struct StageMetrics
+	{
+		uint64_t numPushed;
+		uint64_t numRejected;		//!< Push() calls that found the ring full
+		uint64_t numProcessed;
+		uint64_t numProcessCalls;	//!< Process() calls that found at least one sample
+
+		//! Push() to the end of the Process() call that transformed it
+		double meanLatencyNs;
+		uint64_t maxLatencyNs;
+		//! latencyHistogram[i] counts latencies in [2^i, 2^(i+1)) ns (i = 0 also holds 0)
+		uint64_t latencyHistogram[40];
+
+		//! Samples waiting, seen by each Process() call that found any
+		double meanOccupancy;
+		uint32_t maxOccupancy;
+
+		//! @brief		Latency at or below which fraction (0 to 1) of the samples were, from the
+		//!				histogram. Returns the upper edge of the bin, so is within a factor of 2.
+		uint64_t LatencyPercentileNs(double fraction) const;
+	};
+
+	//! @brief		Forward() stage fed by one producer thread and drained by one consumer thread.
+	//! @details	The producer calls Push() for each sample, which never blocks or allocates. The
+	//!				consumer calls Process(), which transforms every sample that has arrived (up to
+	//!				its output size) with the SIMD batch kernel, in arrival order. The samples sit in
+	//!				an SpscRing of configPARK_STAGE_RING_SIZE, so the two threads never share a lock.
+	//!				GetMetrics() may be called from any thread.
+	class ForwardStage
+	{
+
+	public:
+
+		ForwardStage();
+
+		ForwardStage(const ForwardStage &) = delete;
+		ForwardStage &operator=(const ForwardStage &) = delete;
+
+		//! @brief		Queues a sample. Producer thread only.
+		//! @returns	false, and the sample is dropped (and counted), if the ring is full.
+		bool Push(double alpha, double beta, double theta);
+
+		//! @brief		Transforms up to maxSamples queued samples into d and q. Consumer thread only.
+		//! @returns	The number of samples transformed, 0 if none had arrived.
+		size_t Process(double *d, double *q, size_t maxSamples);
+
+		//! @brief		Returns the metrics so far. Values are updated separately, so a snapshot
+		//!				taken while the stage is running may be slightly inconsistent.
+		StageMetrics GetMetrics() const;
+
+	private:
+
+		//===============================================================================================//
+		//=================================== PRIVATE VARIABLES/STRUCTURES ==============================//
+		//===============================================================================================//
+
+		SpscRing<StageSample, configPARK_STAGE_RING_SIZE> _ring;
+
+		// Written by the producer
+		std::atomic<uint64_t> _numPushed;
+		std::atomic<uint64_t> _numRejected;
+		char _padding[64];
+
+		// Written by the consumer
+		std::atomic<uint64_t> _numProcessed;
+		std::atomic<uint64_t> _numProcessCalls;
+		std::atomic<uint64_t> _sumLatencyNs;
+		std::atomic<uint64_t> _maxLatencyNs;
+		std::atomic<uint64_t> _latencyHistogram[40];
+		std::atomic<uint64_t> _sumOccupancy;
+		std::atomic<uint32_t> _maxOccupancy;
+
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_FORWARD_STAGE_H
+
+// EOF
@@ -0,0 +1,67 @@
+//!
+//! @file 			Frames.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Small value types for returning transform results by value.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_FRAMES_H
+#define PARK_TRANSFORM_FRAMES_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		A value in the rotating d-q reference frame.
+	template <typename T>
+	struct Dq
+	{
+		T d;
+		T q;
+	};
+
+	//! @brief		A value in the rotating d-q reference frame, plus the zero-sequence component.
+	template <typename T>
+	struct Dq0
+	{
+		T d;
+		T q;
+		T zero;
+	};
+
+	//! @brief		A value in the stationary alpha-beta reference frame.
+	template <typename T>
+	struct AlphaBeta
+	{
+		T alpha;
+		T beta;
+	};
+
+	//! @brief		A three-phase quantity, e.g. phase voltages or PWM duty cycles.
+	template <typename T>
+	struct Abc
+	{
+		T a;
+		T b;
+		T c;
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_FRAMES_H
+
+// EOF
@@ -0,0 +1,86 @@
+//!
+//! @file 			ParallelTransformer.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Multi-threaded batch Park transforms, for large offline datasets.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_PARALLEL_TRANSFORMER_H
+#define PARK_TRANSFORM_PARALLEL_TRANSFORMER_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stddef.h>
+
+// User includes
+#include "Config.hpp"
+#include "ThreadPool.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		The batch transforms, split into chunks of configPARK_PARALLEL_CHUNK_SIZE samples
+	//!				and run on a WorkStealingPool.
+	//! @details	Chunk boundaries depend only on the number of samples, and each chunk runs the
+	//!				same SIMD kernel as Transformer::ForwardBatch() etc., so the output is bit for
+	//!				bit the same whatever the number of threads (and the same as the single-threaded
+	//!				Transformer batch functions on the same CPU).
+	//!				Each call splits the work and waits for it, so call from one thread at a time.
+	class ParallelTransformer
+	{
+
+	public:
+
+		//! @brief		Uses numThreads threads, including the caller. 0 uses one per hardware thread.
+		explicit ParallelTransformer(unsigned numThreads = 0);
+
+		unsigned GetNumThreads() const { return _pool.GetNumThreads(); }
+
+		//! @brief		Transformer::ForwardBatch(), over numThreads threads.
+		void ForwardBatch(const double *alpha, const double *beta, const double *theta,
+			double *d, double *q, size_t numSamples);
+
+		//! @brief		Float version of ForwardBatch().
+		void ForwardBatch(const float *alpha, const float *beta, const float *theta,
+			float *d, float *q, size_t numSamples);
+
+		//! @brief		Transformer::InverseBatch(), over numThreads threads.
+		void InverseBatch(const double *d, const double *q, const double *theta,
+			double *alpha, double *beta, size_t numSamples);
+
+		//! @brief		Float version of InverseBatch().
+		void InverseBatch(const float *d, const float *q, const float *theta,
+			float *alpha, float *beta, size_t numSamples);
+
+	private:
+
+		template <typename T>
+		void Rotate(const T *x, const T *y, const T *theta, T *outX, T *outY, size_t numSamples, bool inverse);
+
+		WorkStealingPool _pool;
+
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_PARALLEL_TRANSFORMER_H
+
+// EOF
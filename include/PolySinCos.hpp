@@ -0,0 +1,203 @@
+//!
+//! @file 			PolySinCos.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Minimax polynomial sin/cos, at several accuracy tiers.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_POLY_SIN_COS_H
+#define PARK_TRANSFORM_POLY_SIN_COS_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <math.h>
+#include <stdint.h>
+
+// User includes
+#include "Rotation.hpp"
+#include "Scalar.hpp"
+#include "SinCos.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Accuracy tiers of the polynomial sin/cos. Max abs error of sin and cos in double,
+	//!				over the whole fast range (checked in test/PolySinCosTests.cpp):
+	enum class PolyAccuracy
+	{
+		LOW,		//!< 1.6e-4. Degree 3 sin, degree 4 cos. Enough for a current loop.
+		MEDIUM,		//!< 3e-8. Degree 7 sin, degree 6 cos.
+		FULL		//!< 2e-16, i.e. as good as libm. Degree 13 sin, degree 14 cos (Cephes).
+	};
+	// In float, MEDIUM and FULL are both limited by float rounding, to about 1.4e-7 and 9e-8.
+
+	//! Number of PolyAccuracy tiers
+	static const int numPolyAccuracies = 3;
+
+	//! @brief		Polynomial coefficients for each tier, highest power first, stored as T.
+	//! @details	With theta reduced to r in [-pi/4, pi/4] and z = r*r:
+	//!					sin(r) = r*S(z), cos(r) = C(z)
+	//!				LOW and MEDIUM are minimax (Remez) fits for absolute error on [0, pi/4].
+	template <typename T, PolyAccuracy accuracy> struct PolyCoeffs;
+
+	template <typename T> struct PolyCoeffs<T, PolyAccuracy::LOW>
+	{
+		static constexpr int numSin = 2;
+		static constexpr int numCos = 3;
+		static constexpr T sinCoeffs[numSin] = { -0.1603440167234622, 0.9990314229131833 };
+		static constexpr T cosCoeffs[numCos] = { 0.04039853596906776, -0.49970814035693445, 0.9999900349553448 };
+	};
+
+	template <typename T> struct PolyCoeffs<T, PolyAccuracy::MEDIUM>
+	{
+		static constexpr int numSin = 4;
+		static constexpr int numCos = 4;
+		static constexpr T sinCoeffs[numSin] = {
+			-0.00019462117000783503, 0.008331584606514487, -0.16666636754300287, 0.9999999861793425 };
+		static constexpr T cosCoeffs[numCos] = {
+			-0.0013585908510622608, 0.04165502688429943, -0.49999856695849865, 0.9999999724233232 };
+	};
+
+	template <typename T> struct PolyCoeffs<T, PolyAccuracy::FULL>
+	{
+		static constexpr int numSin = 7;
+		static constexpr int numCos = 8;
+		static constexpr T sinCoeffs[numSin] = {
+			1.58962301576546568060E-10, -2.50507477628578072866E-8, 2.75573136213857245213E-6,
+			-1.98412698295895385996E-4, 8.33333333332211858878E-3, -1.66666666666666307295E-1, 1.0 };
+		static constexpr T cosCoeffs[numCos] = {
+			-1.13585365213876817300E-11, 2.08757008419747316778E-9, -2.75573141792967388112E-7,
+			2.48015872888517045348E-5, -1.38888888888730564116E-3, 4.16666666666665929218E-2, -0.5, 1.0 };
+	};
+
+	// Out-of-class definitions, needed because the coefficient arrays are indexed at run time
+	template <typename T> constexpr T PolyCoeffs<T, PolyAccuracy::LOW>::sinCoeffs[];
+	template <typename T> constexpr T PolyCoeffs<T, PolyAccuracy::LOW>::cosCoeffs[];
+	template <typename T> constexpr T PolyCoeffs<T, PolyAccuracy::MEDIUM>::sinCoeffs[];
+	template <typename T> constexpr T PolyCoeffs<T, PolyAccuracy::MEDIUM>::cosCoeffs[];
+	template <typename T> constexpr T PolyCoeffs<T, PolyAccuracy::FULL>::sinCoeffs[];
+	template <typename T> constexpr T PolyCoeffs<T, PolyAccuracy::FULL>::cosCoeffs[];
+
+	//! @brief		Range reduction constants, per scalar type.
+	//! @details	theta - n*pi/2 is computed with pi/2 split into three parts (Cody-Waite), which is
+	//!				exact enough for |theta| <= maxTheta. Larger angles, which a Park transform
+	//!				should never see, fall back to libm.
+	template <typename T> struct PolyReduction;
+
+	template <> struct PolyReduction<double>
+	{
+		static constexpr double twoOverPi = 6.36619772367581382433e-01;
+		static constexpr double pio2_1 = 1.57079632673412561417e+00;
+		static constexpr double pio2_2 = 6.07710050630396597660e-11;
+		static constexpr double pio2_3 = 2.02226624871116645580e-21;
+		static constexpr double maxTheta = 1e5;
+		//! Adding then subtracting this rounds to the nearest integer, without a libm call
+		static constexpr double roundMagic = 6755399441055744.0;
+	};
+
+	template <> struct PolyReduction<float>
+	{
+		static constexpr float twoOverPi = 6.36619772367581382433e-01f;
+		static constexpr float pio2_1 = 1.5703125f;
+		static constexpr float pio2_2 = 4.837512969970703125e-4f;
+		static constexpr float pio2_3 = 7.54978995489188216e-8f;
+		static constexpr float maxTheta = 8192.0f;
+		static constexpr float roundMagic = 12582912.0f;
+	};
+
+	//! @brief		Evaluates a polynomial in z, coefficients highest power first.
+	//! @note		PolyEval() and PolySinCos() are static, like SinCos(), so the copies compiled into
+	//!				SimdAvx2.cpp and SimdAvx512.cpp stay local and are never linked into scalar code.
+	template <typename T, int numCoeffs>
+	static inline T PolyEval(const T (&coeffs)[numCoeffs], T z)
+	{
+		T sum = coeffs[0];
+		for(int i = 1; i < numCoeffs; i++)
+			sum = sum*z + coeffs[i];
+		return sum;
+	}
+
+	//! @brief		sin and cos of theta (radians) to the given accuracy tier. T is float or double.
+	//! @note		Thread-safe.
+	template <PolyAccuracy accuracy, typename T>
+	static inline void PolySinCos(T theta, T *sinTheta, T *cosTheta)
+	{
+		typedef PolyReduction<T> R;
+		typedef PolyCoeffs<T, accuracy> C;
+
+		// Written so that NaN also takes the slow path
+		if(!(fabs(theta) <= R::maxTheta))
+		{
+			SinCos(theta, sinTheta, cosTheta);
+			return;
+		}
+
+		T n = (theta*R::twoOverPi + R::roundMagic) - R::roundMagic;
+		T r = theta - n*R::pio2_1;
+		r = r - n*R::pio2_2;
+		r = r - n*R::pio2_3;
+		T z = r*r;
+
+		T sinR = r*PolyEval(C::sinCoeffs, z);
+		T cosR = PolyEval(C::cosCoeffs, z);
+
+		// Rotate by the quadrant, n mod 4
+		switch((int32_t)n & 3)
+		{
+			case 0:
+				*sinTheta = sinR;
+				*cosTheta = cosR;
+				break;
+			case 1:
+				*sinTheta = cosR;
+				*cosTheta = -sinR;
+				break;
+			case 2:
+				*sinTheta = -sinR;
+				*cosTheta = -cosR;
+				break;
+			default:
+				*sinTheta = -cosR;
+				*cosTheta = sinR;
+				break;
+		}
+	}
+
+	//! @brief		Trig policy for BasicTransformer (see TrigPolicies.hpp) using PolySinCos(),
+	//!				in the precision of the angle policy's radians.
+	template <PolyAccuracy accuracy>
+	struct PolyTrig
+	{
+		template <typename T, class AnglePolicy>
+		static Rotation<T> CalcRotation(typename AnglePolicy::angle_type theta)
+		{
+			auto radians = AnglePolicy::ToRadians(theta);
+			decltype(radians) sinTheta, cosTheta;
+			PolySinCos<accuracy>(radians, &sinTheta, &cosTheta);
+			return Rotation<T>(ScalarTraits<T>::FromDouble(cosTheta), ScalarTraits<T>::FromDouble(sinTheta));
+		}
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_POLY_SIN_COS_H
+
+// EOF
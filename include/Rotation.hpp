@@ -0,0 +1,60 @@
+//!
+//! @file 			Rotation.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Precomputed cosine/sine pair for one Park transform angle.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_ROTATION_H
+#define PARK_TRANSFORM_ROTATION_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Holds cos(theta) and sin(theta) for one angle.
+	//! @details	Get one from Transformer::CalcRotation() and pass it to the Forward()/Inverse()
+	//!				overloads that take a rotation, so the trig is only evaluated once no matter
+	//!				how many signals are transformed at the same angle.
+	//!				T is double, or Fp::fp<CDP> for the fixed-point functions.
+	template <typename T>
+	class Rotation
+	{
+
+	public:
+
+		Rotation() {}
+
+		constexpr Rotation(T cosTheta, T sinTheta) :
+			cosTheta(cosTheta),
+			sinTheta(sinTheta)
+		{}
+
+		//===============================================================================================//
+		//====================================== PUBLIC VARIABLES =======================================//
+		//===============================================================================================//
+
+		T cosTheta;
+		T sinTheta;
+
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_ROTATION_H
+
+// EOF
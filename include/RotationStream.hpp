@@ -0,0 +1,206 @@
+//!
+//! @file 			RotationStream.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Generates the rotation for evenly spaced angles with a phasor recurrence.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_ROTATION_STREAM_H
+#define PARK_TRANSFORM_ROTATION_STREAM_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <math.h>
+#include <stdint.h>
+
+// User includes
+#include "Rotation.hpp"
+#include "SinCos.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Rotations for theta0, theta0 + deltaTheta, theta0 + 2*deltaTheta, ...
+	//!				without evaluating sin/cos per sample.
+	//! @details	Each Next() multiplies the current phasor (cos + j*sin) by the fixed step
+	//!				phasor, i.e. 4 multiplies and 2 adds. Rounding makes the phasor drift in two ways:
+	//!				- Magnitude. Pulled back to 1 every renormInterval samples with one Newton step,
+	//!				  k = (3 - (cos^2 + sin^2))/2, which needs no sqrt or divide.
+	//!				- Phase. Not corrected by renormalising, it grows by about one ulp per sample, so
+	//!				  the phasor is re-seeded exactly with sincos() every resyncInterval samples.
+	//!				Error bounds (max |cos - cos(theta)|, |sin - sin(theta)| against the exact angle
+	//!				theta0 + n*deltaTheta, checked in test/RotationStreamTests.cpp):
+	//!				- double: < 2e-16*resyncInterval, e.g. 2e-13 with the default 1024.
+	//!				- float: < 6e-8*resyncInterval, e.g. 4e-6 with 64. Rounding each product to float
+	//!				  dominates, so use a short resyncInterval.
+	//!				The angle itself is tracked to ~1e-30 rad, so these bounds hold for any stream length.
+	//!				Only valid for T = float or double.
+	//! @note		Not thread-safe, use one stream per thread.
+	template <typename T>
+	class RotationStream
+	{
+
+	public:
+
+		//! Samples between magnitude corrections. Drift over this many samples is a few ulp.
+		static constexpr uint32_t renormInterval = 16;
+
+		//===============================================================================================//
+		//======================================= PUBLIC METHODS ========================================//
+		//===============================================================================================//
+
+		//! @brief		Starts the stream at theta0, stepping by deltaTheta (both in radians).
+		//! @param		resyncInterval		Samples between exact sincos() re-seeds. Must be > 0.
+		RotationStream(double theta0, double deltaTheta, uint32_t resyncInterval = 1024) :
+			_thetaHi(theta0),
+			_thetaLo(0.0),
+			_deltaTheta(deltaTheta),
+			_resyncInterval(resyncInterval)
+		{
+			double sinStep, cosStep;
+			SinCos(deltaTheta, &sinStep, &cosStep);
+			_step = Rotation<T>((T)cosStep, (T)sinStep);
+			Resync(0);
+		}
+
+		//! @brief		The rotation for the current angle.
+		const Rotation<T> &Get() const
+		{
+			return _rotation;
+		}
+
+		//! @brief		The current angle, in radians. Wrapped to [-pi, pi] at every re-seed.
+		double GetTheta() const
+		{
+			return _thetaHi + ((double)_numSinceResync*_deltaTheta + _thetaLo);
+		}
+
+		//! @brief		Advances to the next angle.
+		void Next()
+		{
+			if(++_numSinceResync == _resyncInterval)
+				Resync(_numSinceResync);
+			else
+				Step(&_rotation, &_numToRenorm);
+		}
+
+		//! @brief		Writes the rotations for the next numRotations angles to rotations, starting
+		//!				with the current one, and advances past them.
+		//! @details	Faster than Get() and Next() per sample, the recurrence stays in registers.
+		void Generate(Rotation<T> *rotations, size_t numRotations)
+		{
+			Rotation<T> rotation = _rotation;
+			uint32_t numToRenorm = _numToRenorm;
+			for(size_t i = 0; i < numRotations; i++)
+			{
+				rotations[i] = rotation;
+				if(++_numSinceResync == _resyncInterval)
+				{
+					Resync(_numSinceResync);
+					rotation = _rotation;
+					numToRenorm = _numToRenorm;
+				}
+				else
+					Step(&rotation, &numToRenorm);
+			}
+			_rotation = rotation;
+			_numToRenorm = numToRenorm;
+		}
+
+	private:
+
+		//! @brief		Multiplies rotation by the step phasor, renormalising every renormInterval calls.
+		void Step(Rotation<T> *rotation, uint32_t *numToRenorm) const
+		{
+			T cosTheta = rotation->cosTheta*_step.cosTheta - rotation->sinTheta*_step.sinTheta;
+			T sinTheta = rotation->sinTheta*_step.cosTheta + rotation->cosTheta*_step.sinTheta;
+
+			if(--*numToRenorm == 0)
+			{
+				T k = (T)1.5 - (T)0.5*(cosTheta*cosTheta + sinTheta*sinTheta);
+				cosTheta *= k;
+				sinTheta *= k;
+				*numToRenorm = renormInterval;
+			}
+
+			*rotation = Rotation<T>(cosTheta, sinTheta);
+		}
+
+		//! @brief		Exact a + b = *sum + *err (Knuth's two-sum).
+		static void TwoSum(double a, double b, double *sum, double *err)
+		{
+			*sum = a + b;
+			double bVirtual = *sum - a;
+			*err = (a - (*sum - bVirtual)) + (b - bVirtual);
+		}
+
+		//! @brief		Adds a*b to the angle, keeping the rounding error in _thetaLo.
+		void AddProduct(double a, double b)
+		{
+			double product = a*b;
+			double productErr = fma(a, b, -product);
+			double sum, sumErr;
+			TwoSum(_thetaHi, product, &sum, &sumErr);
+			TwoSum(sum, _thetaLo + productErr + sumErr, &_thetaHi, &_thetaLo);
+		}
+
+		//! @brief		Re-seeds exactly, numSteps steps past the last re-seed.
+		void Resync(uint32_t numSteps)
+		{
+			// The angle is held as an unevaluated sum _thetaHi + _thetaLo and wrapped to one turn, so
+			// it neither loses precision on long streams nor drifts from rounding at each re-seed
+			AddProduct((double)numSteps, _deltaTheta);
+			double numTurns = nearbyint(_thetaHi*(0.5/M_PI));
+			AddProduct(-numTurns, twoPiHi);
+			AddProduct(-numTurns, twoPiLo);
+			_numSinceResync = 0;
+			_numToRenorm = renormInterval;
+
+			// sin(hi + lo) = sin(hi) + lo*cos(hi), lo is far too small for the next term to matter
+			double sinTheta, cosTheta;
+			SinCos(_thetaHi, &sinTheta, &cosTheta);
+			_rotation = Rotation<T>((T)(cosTheta - _thetaLo*sinTheta), (T)(sinTheta + _thetaLo*cosTheta));
+		}
+
+		//! 2*pi split into a double and the remainder
+		static constexpr double twoPiHi = 6.283185307179586;
+		static constexpr double twoPiLo = 2.4492935982947064e-16;
+
+		//===============================================================================================//
+		//===================================== PRIVATE VARIABLES =======================================//
+		//===============================================================================================//
+
+		Rotation<T> _rotation;
+		Rotation<T> _step;
+		double _thetaHi;
+		double _thetaLo;
+		double _deltaTheta;
+		uint32_t _resyncInterval;
+		uint32_t _numSinceResync;
+		uint32_t _numToRenorm;
+
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_ROTATION_STREAM_H
+
+// EOF
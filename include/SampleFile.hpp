@@ -0,0 +1,220 @@
+//!
+//! @file 			SampleFile.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Columnar binary sample files, memory-mapped for zero-copy batch transforms.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_SAMPLE_FILE_H
+#define PARK_TRANSFORM_SAMPLE_FILE_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stddef.h>
+#include <stdint.h>
+
+// User includes
+#include "Config.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Type of every value in a sample file.
+	enum class SampleType : uint8_t
+	{
+		FLOAT64 = 1,
+		FLOAT32 = 2,
+		INT32 = 3		//!< Fixed point, value*2^cdp. theta is in LUT entries, like the fixed-point
+						//!< transforms, with thetaPerTurn entries in one turn
+	};
+
+	//! @brief		Which stream a sample file holds, and so its columns.
+	enum class SampleLayout : uint8_t
+	{
+		ALPHA_BETA_THETA = 1,	//!< Columns ALPHA, BETA, THETA
+		DQ = 2					//!< Columns D, Q
+	};
+
+	//! @brief		Column indexes, for SampleFileReader/SampleFileWriter::GetColumn().
+	struct SampleColumn
+	{
+		enum : unsigned
+		{
+			ALPHA = 0,
+			BETA = 1,
+			THETA = 2,
+			D = 0,
+			Q = 1
+		};
+	};
+
+	//! @brief		The first 64 bytes of a sample file, little-endian.
+	//! @details	The file is this header followed by each column in turn, numSamples values
+	//!				long. Column c starts at headerSize + c*columnStride bytes, and both are
+	//!				multiples of 64, so the mapped columns are aligned for the SIMD kernels.
+	//!				Readers reject other versions, and ignore header bytes beyond the ones they
+	//!				know about (headerSize may grow in later versions).
+	struct SampleFileHeader
+	{
+		char magic[8];			//!< "PARKSMPL"
+		uint16_t version;		//!< sampleFileVersion
+		uint16_t headerSize;	//!< Offset of the first column, in bytes
+		SampleLayout layout;
+		SampleType type;
+		uint8_t cdp;			//!< Fraction bits of INT32 values, 0 for the float types
+		uint8_t numColumns;
+		uint64_t numSamples;
+		double sampleRate;		//!< In Hz, 0 if unknown
+		uint64_t columnStride;	//!< Bytes from the start of one column to the next
+		uint32_t thetaPerTurn;	//!< INT32 ALPHA_BETA_THETA files: theta units in one turn (the LUT
+								//!< size), 0 for every other file
+		uint8_t reserved[20];
+	};
+
+	static_assert(sizeof(SampleFileHeader) == 64, "The sample file header must be 64 bytes.");
+
+	static const uint16_t sampleFileVersion = 1;
+
+	//! @brief		Size of one value of the given type, in bytes.
+	size_t SampleTypeSize(SampleType type);
+
+	//! @brief		Number of columns in a file of the given layout.
+	unsigned SampleLayoutNumColumns(SampleLayout layout);
+
+	//! @brief		The SampleType of each C++ type.
+	template <typename T> struct SampleTypeOf;
+	template <> struct SampleTypeOf<double> { static constexpr SampleType value = SampleType::FLOAT64; };
+	template <> struct SampleTypeOf<float> { static constexpr SampleType value = SampleType::FLOAT32; };
+	template <> struct SampleTypeOf<int32_t> { static constexpr SampleType value = SampleType::INT32; };
+
+	//! @brief		Maps a sample file read-only. The columns are used in place, no copies are made.
+	//! @details	Only on POSIX systems, elsewhere Open() always fails.
+	class SampleFileReader
+	{
+
+	public:
+
+		SampleFileReader();
+
+		//! @brief		Calls Close().
+		~SampleFileReader();
+
+		//! @brief		Maps the file and checks its header and size. Returns false if the file
+		//!				can't be mapped, or isn't a valid sample file of a version this reads.
+		bool Open(const char *path);
+
+		//! @brief		Unmaps the file. Pointers from GetColumn() are invalid afterwards.
+		void Close();
+
+		bool IsOpen() const { return _data != NULL; }
+
+		const SampleFileHeader &GetHeader() const { return _header; }
+
+		size_t GetNumSamples() const { return (size_t)_header.numSamples; }
+
+		//! @brief		The mapped values of a column, or NULL if the file isn't open, T isn't the
+		//!				file's type or the column doesn't exist.
+		template <typename T>
+		const T *GetColumn(unsigned column) const
+		{
+			if(!_data || SampleTypeOf<T>::value != _header.type || column >= _header.numColumns)
+				return NULL;
+			return (const T *)(_data + _header.headerSize + column*_header.columnStride);
+		}
+
+	private:
+
+		// Not copyable, it owns the mapping
+		SampleFileReader(const SampleFileReader &);
+		SampleFileReader &operator=(const SampleFileReader &);
+
+		const uint8_t *_data;
+		size_t _size;
+		SampleFileHeader _header;
+
+	};
+
+	//! @brief		Creates a sample file of a known number of samples and maps it read-write, so the
+	//!				columns can be written (e.g. by a batch transform) in place.
+	//! @details	Only on POSIX systems, elsewhere Create() always fails.
+	class SampleFileWriter
+	{
+
+	public:
+
+		SampleFileWriter();
+
+		//! @brief		Calls Close().
+		~SampleFileWriter();
+
+		//! @brief		Creates (or truncates) the file at its full size, with the header written
+		//!				and every value 0. Returns false if it can't be created or mapped.
+		//! @details	thetaPerTurn is only stored for INT32 ALPHA_BETA_THETA files, and the default
+		//!				matches Transformer::Forward(Fp::fp<CDP>...).
+		bool Create(const char *path, SampleLayout layout, SampleType type, size_t numSamples,
+			double sampleRate, uint8_t cdp = 0, uint32_t thetaPerTurn = configPARK_LUT_SIZE);
+
+		//! @brief		Writes the file back (msync()), unmaps and closes it. Returns false if writing
+		//!				it back failed.
+		bool Close();
+
+		bool IsOpen() const { return _data != NULL; }
+
+		const SampleFileHeader &GetHeader() const { return _header; }
+
+		//! @brief		The mapped values of a column, or NULL if the file isn't open, T isn't the
+		//!				file's type or the column doesn't exist.
+		template <typename T>
+		T *GetColumn(unsigned column) const
+		{
+			if(!_data || SampleTypeOf<T>::value != _header.type || column >= _header.numColumns)
+				return NULL;
+			return (T *)(_data + _header.headerSize + column*_header.columnStride);
+		}
+
+	private:
+
+		// Not copyable, it owns the mapping
+		SampleFileWriter(const SampleFileWriter &);
+		SampleFileWriter &operator=(const SampleFileWriter &);
+
+		uint8_t *_data;
+		size_t _size;
+		int _fd;
+		SampleFileHeader _header;
+
+	};
+
+	//! @brief		Forward transforms an ALPHA_BETA_THETA file into a new DQ file of the same type,
+	//!				sample rate and CDP.
+	//! @details	FLOAT64 and FLOAT32 files go through the SIMD ForwardBatch() kernel straight
+	//!				from the input mapping to the output mapping. INT32 files are converted to
+	//!				double (theta from thetaPerTurn units to radians) and back (rounded and
+	//!				saturated) in cache-sized chunks.
+	//!				Returns false if either file can't be mapped, the input isn't ALPHA_BETA_THETA
+	//!				or both paths are the same file.
+	bool ForwardFile(const char *inPath, const char *outPath);
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_SAMPLE_FILE_H
+
+// EOF
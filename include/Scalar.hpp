@@ -0,0 +1,176 @@
+//!
+//! @file 			Scalar.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Scalar types and arithmetic traits used by BasicTransformer.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_SCALAR_H
+#define PARK_TRANSFORM_SCALAR_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>
+
+// User includes
+#include "Config.hpp"
+
+#if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
+	// fixed-point-cpp, its api directory must be on the include path
+	#include "FixedPoint.hpp"
+#endif
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Signed fixed-point number, raw/2^fracBits, stored in RawT (int16_t or int32_t).
+	//! @details	Arithmetic through ScalarTraits saturates instead of wrapping.
+	template <typename RawT, uint8_t fracBits>
+	struct QFixed
+	{
+		static_assert(fracBits < sizeof(RawT)*8, "Too many fraction bits for the raw type.");
+
+		static constexpr uint8_t numFracBits = fracBits;
+
+		RawT raw;
+	};
+
+	//! Q1.15, range [-1, 1)
+	typedef QFixed<int16_t, 15> Q15;
+
+	//! Q1.31, range [-1, 1)
+	typedef QFixed<int32_t, 31> Q31;
+
+	//! @brief		Arithmetic used by BasicTransformer, specialised per scalar type.
+	//! @details	Each specialisation provides:
+	//!					static T FromDouble(double value)
+	//!					static int32_t Raw(T value), numFracBits	(fixed-point types only)
+	//!					static T FromRaw(int32_t raw, uint8_t rawFracBits)	(fixed-point sin/cos)
+	//!					static double ToDouble(T value)
+	//!					static T Add(T, T), Sub(T, T), Mul(T, T)
+	//!					static bool Less(T, T)
+	template <typename T>
+	struct ScalarTraits;
+
+	//! @brief		Shared floating point implementation.
+	template <typename T>
+	struct FloatScalarTraits
+	{
+		static constexpr T FromDouble(double value) { return (T)value; }
+		static constexpr T FromRaw(int32_t raw, uint8_t rawFracBits) { return (T)raw/(T)((int64_t)1 << rawFracBits); }
+		static constexpr double ToDouble(T value) { return (double)value; }
+		static constexpr T Add(T a, T b) { return a + b; }
+		static constexpr T Sub(T a, T b) { return a - b; }
+		static constexpr T Mul(T a, T b) { return a*b; }
+		static constexpr bool Less(T a, T b) { return a < b; }
+	};
+
+	template <> struct ScalarTraits<float> : FloatScalarTraits<float> {};
+	template <> struct ScalarTraits<double> : FloatScalarTraits<double> {};
+
+	//! @brief		Saturating QFixed implementation.
+	template <typename RawT, uint8_t fracBits>
+	struct ScalarTraits<QFixed<RawT, fracBits> >
+	{
+		typedef QFixed<RawT, fracBits> T;
+
+		static constexpr int64_t maxRaw = ((int64_t)1 << (sizeof(RawT)*8 - 1)) - 1;
+		static constexpr int64_t minRaw = -maxRaw - 1;
+
+		static T Saturate(int64_t raw)
+		{
+			T result;
+			result.raw = (RawT)(raw > maxRaw ? maxRaw : (raw < minRaw ? minRaw : raw));
+			return result;
+		}
+
+		static T FromDouble(double value)
+		{
+			double scaled = value*(double)((int64_t)1 << fracBits);
+			// Clamp in double first, the conversion of an out-of-range double is undefined
+			if(scaled >= (double)maxRaw)
+				return Saturate(maxRaw);
+			if(scaled <= (double)minRaw)
+				return Saturate(minRaw);
+			return Saturate((int64_t)(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5));
+		}
+
+		static T FromRaw(int32_t raw, uint8_t rawFracBits)
+		{
+			// e.g. 1.0 from a LUT saturates to the largest Q15/Q31 value
+			if(rawFracBits >= fracBits)
+				return Saturate((int64_t)raw >> (rawFracBits - fracBits));
+			return Saturate((int64_t)raw*((int64_t)1 << (fracBits - rawFracBits)));
+		}
+
+		static double ToDouble(T value)
+		{
+			return (double)value.raw/(double)((int64_t)1 << fracBits);
+		}
+
+		static constexpr uint8_t numFracBits = fracBits;
+		static int32_t Raw(T value) { return value.raw; }
+
+		static T Add(T a, T b) { return Saturate((int64_t)a.raw + b.raw); }
+		static T Sub(T a, T b) { return Saturate((int64_t)a.raw - b.raw); }
+
+		static T Mul(T a, T b)
+		{
+			// Round to nearest
+			return Saturate(((int64_t)a.raw*b.raw + ((int64_t)1 << (fracBits - 1))) >> fracBits);
+		}
+
+		static bool Less(T a, T b) { return a.raw < b.raw; }
+	};
+
+	#if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
+		//! @brief		fixed-point-cpp's fp<p>, using its own operators.
+		template <uint8_t p>
+		struct ScalarTraits<Fp::fp<p> >
+		{
+			typedef Fp::fp<p> T;
+
+			static T FromDouble(double value) { return T(value); }
+
+			static T FromRaw(int32_t raw, uint8_t rawFracBits)
+			{
+				T result;
+				result.intValue = (rawFracBits >= p) ? (raw >> (rawFracBits - p)) : (raw << (p - rawFracBits));
+				return result;
+			}
+
+			static double ToDouble(T value) { return Fp::Fix2Float<p>(value.intValue); }
+
+			static constexpr uint8_t numFracBits = p;
+			static int32_t Raw(T value) { return value.intValue; }
+
+			static T Add(T a, T b) { return a + b; }
+			static T Sub(T a, T b) { return a - b; }
+			static T Mul(T a, T b) { return a*b; }
+			static bool Less(T a, T b) { return a.intValue < b.intValue; }
+		};
+	#endif
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_SCALAR_H
+
+// EOF
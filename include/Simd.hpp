@@ -0,0 +1,142 @@
+//!
+//! @file 			Simd.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Vectorised (AVX2/AVX-512) batch Park transforms with runtime CPU dispatch.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_SIMD_H
+#define PARK_TRANSFORM_SIMD_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stddef.h>		// size_t
+
+// User includes
+#include "PolySinCos.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+	namespace Simd
+	{
+
+		//! @brief		Instruction sets that the batch kernels are built for.
+		enum class Isa
+		{
+			SCALAR,		//!< Plain C++ using sincos(), always available. Used as the reference.
+			AVX2,		//!< x86-64 AVX2 + FMA, 4 doubles or 8 floats per vector.
+			AVX512		//!< x86-64 AVX-512F, 8 doubles or 16 floats per vector.
+		};
+
+		//! @brief		Returns true if both this build and the CPU it is running on support isa.
+		//! @note		Thread-safe.
+		bool IsSupported(Isa isa);
+
+		//! @brief		Returns the widest supported instruction set, up to the SetMaxIsa() cap.
+		//!				Checked once (CPUID), then cached.
+		//! @details	Transformer::ForwardBatch()/InverseBatch() use this.
+		//! @note		Thread-safe.
+		Isa GetBestIsa();
+
+		//! @brief		Caps what GetBestIsa() returns, and so the kernels Transformer's batch methods
+		//!				use, e.g. to time or test a narrower kernel on a wider CPU. Pass AVX512 to
+		//!				remove the cap (the default).
+		//! @note		Thread-safe, but applies to every thread.
+		void SetMaxIsa(Isa isa);
+
+		//! @brief		Returns a printable name for isa, e.g. "AVX2".
+		const char *GetIsaName(Isa isa);
+
+		//! @brief		Forward Park transform over arrays, using the given instruction set.
+		//! @details	Vector kernels evaluate sin/cos with a polynomial after reducing theta
+		//!				modulo pi/2. Results agree with the scalar kernel to a few ulp, i.e. within
+		//!				1e-12*(|alpha| + |beta|) for double and 1e-5*(|alpha| + |beta|) for float.
+		//!				Lanes with |theta| > 1e5 (double) or 8192 (float), or non-finite theta,
+		//!				fall back to the scalar kernel.
+		//!				The result for a sample does not depend on its position in the array.
+		//!				If isa is not supported, SCALAR is used.
+		//!				d may alias alpha and q may alias beta.
+		//! @note		Thread-safe.
+		void ForwardBatch(Isa isa, const double *alpha, const double *beta, const double *theta,
+			double *d, double *q, size_t numSamples);
+
+		//! @brief		Float version of ForwardBatch().
+		void ForwardBatch(Isa isa, const float *alpha, const float *beta, const float *theta,
+			float *d, float *q, size_t numSamples);
+
+		//! @brief		ForwardBatch() with sin/cos to the given accuracy tier (see PolySinCos.hpp).
+		//! @details	FULL is the same as ForwardBatch() above. LOW and MEDIUM give the same results
+		//!				as PolySinCos() to within a few ulp on every instruction set. Out-of-range
+		//!				lanes fall back to libm, so are never less accurate.
+		//! @note		Thread-safe.
+		void ForwardBatch(Isa isa, PolyAccuracy accuracy, const double *alpha, const double *beta,
+			const double *theta, double *d, double *q, size_t numSamples);
+
+		//! @brief		Float version of ForwardBatch() with an accuracy tier.
+		void ForwardBatch(Isa isa, PolyAccuracy accuracy, const float *alpha, const float *beta,
+			const float *theta, float *d, float *q, size_t numSamples);
+
+		//! @brief		Inverse Park transform over arrays, using the given instruction set.
+		//! @details	See ForwardBatch() for accuracy. alpha may alias d and beta may alias q.
+		//! @note		Thread-safe.
+		void InverseBatch(Isa isa, const double *d, const double *q, const double *theta,
+			double *alpha, double *beta, size_t numSamples);
+
+		//! @brief		Float version of InverseBatch().
+		void InverseBatch(Isa isa, const float *d, const float *q, const float *theta,
+			float *alpha, float *beta, size_t numSamples);
+
+		//! @brief		InverseBatch() with sin/cos to the given accuracy tier (see PolySinCos.hpp).
+		//! @note		Thread-safe.
+		void InverseBatch(Isa isa, PolyAccuracy accuracy, const double *d, const double *q,
+			const double *theta, double *alpha, double *beta, size_t numSamples);
+
+		//! @brief		Float version of InverseBatch() with an accuracy tier.
+		void InverseBatch(Isa isa, PolyAccuracy accuracy, const float *d, const float *q,
+			const float *theta, float *alpha, float *beta, size_t numSamples);
+
+		//! @brief		Clarke + forward Park transform over arrays, straight from three-phase
+		//!				quantities to d-q-0 without storing alpha/beta.
+		//! @details	Same maths and accuracy as BasicTransformer::ForwardFromABC() and
+		//!				ForwardBatch(). zero may be NULL if it is not needed. Outputs may alias inputs.
+		//! @note		Thread-safe.
+		void ForwardFromABCBatch(Isa isa, const double *a, const double *b, const double *c,
+			const double *theta, double *d, double *q, double *zero, size_t numSamples);
+
+		//! @brief		Float version of ForwardFromABCBatch().
+		void ForwardFromABCBatch(Isa isa, const float *a, const float *b, const float *c,
+			const float *theta, float *d, float *q, float *zero, size_t numSamples);
+
+		//! @brief		ForwardFromABCBatch() for two phase sensors, with c = -a - b.
+		//! @note		Thread-safe.
+		void ForwardFromABBatch(Isa isa, const double *a, const double *b, const double *theta,
+			double *d, double *q, size_t numSamples);
+
+		//! @brief		Float version of ForwardFromABBatch().
+		void ForwardFromABBatch(Isa isa, const float *a, const float *b, const float *theta,
+			float *d, float *q, size_t numSamples);
+
+	} // namespace Simd
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_SIMD_H
+
+// EOF
@@ -0,0 +1,50 @@
+//!
+//! @file 			SinCos.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Helpers that evaluate sin and cos of one angle together (libm).
+//! @details
+//!					Functions are static so that the copies compiled into the SIMD
+//!					translation units (built with -mavx2 etc.) are never shared with
+//!					the rest of the library.
+
+#ifndef PARK_TRANSFORM_SIN_COS_H
+#define PARK_TRANSFORM_SIN_COS_H
+
+#include <math.h>
+
+namespace ParkTransform
+{
+
+	//! @brief		Calculates sin(theta) and cos(theta) with a single fused evaluation.
+	//! @details	glibc's sincos() shares the argument reduction between sin and cos, and gives
+	//!				the same results as calling sin() and cos() separately. Other platforms fall
+	//!				back to two calls.
+	static inline void SinCos(double theta, double *sinTheta, double *cosTheta)
+	{
+		#if defined(__GLIBC__)
+			sincos(theta, sinTheta, cosTheta);
+		#else
+			*sinTheta = sin(theta);
+			*cosTheta = cos(theta);
+		#endif
+	}
+
+	//! @brief		Float version of SinCos().
+	static inline void SinCos(float theta, float *sinTheta, float *cosTheta)
+	{
+		#if defined(__GLIBC__)
+			sincosf(theta, sinTheta, cosTheta);
+		#else
+			*sinTheta = sinf(theta);
+			*cosTheta = cosf(theta);
+		#endif
+	}
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_SIN_COS_H
+
+// EOF
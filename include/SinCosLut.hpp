@@ -0,0 +1,308 @@
+//!
+//! @file 			SinCosLut.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Sine and cosine look-up tables, generated at compile time.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_SIN_COS_LUT_H
+#define PARK_TRANSFORM_SIN_COS_LUT_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>
+
+// User includes
+#include "BinaryAngle.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	namespace LutMaths
+	{
+		constexpr double pi = 3.14159265358979323846;
+
+		//! @brief		sin(x) for x in [-pi, pi], usable in constant expressions.
+		//! @details	Folds x into [-pi/2, pi/2] then sums the Taylor series, which is accurate to
+		//!				about 1e-16 in that range.
+		constexpr double Sin(double x)
+		{
+			if(x > pi/2.0)
+				x = pi - x;
+			else if(x < -pi/2.0)
+				x = -pi - x;
+
+			double term = x;
+			double sum = x;
+			for(int n = 1; n < 20; n++)
+			{
+				term *= -x*x/((2.0*n)*(2.0*n + 1.0));
+				sum += term;
+			}
+			return sum;
+		}
+
+		//! @brief		sin(2*pi*index/size), usable in constant expressions.
+		constexpr double SinOfIndex(uint32_t index, uint32_t size)
+		{
+			// Reduce to [-size/2, size/2] in integer maths first, so there is no rounding error
+			// from large angles
+			int64_t i = (int64_t)(index % size);
+			if(2*i > (int64_t)size)
+				i -= size;
+			return Sin(2.0*pi*(double)i/(double)size);
+		}
+
+		//! @brief		cos(2*pi*index/size), usable in constant expressions.
+		constexpr double CosOfIndex(uint32_t index, uint32_t size)
+		{
+			// cos is even, so fold to an angle in [0, pi], then cos(x) = sin(pi/2 - x)
+			int64_t i = (int64_t)(index % size);
+			if(2*i > (int64_t)size)
+				i = (int64_t)size - i;
+			return Sin(pi/2.0 - 2.0*pi*(double)i/(double)size);
+		}
+
+		constexpr bool IsPowerOfTwo(uint32_t value)
+		{
+			return value != 0 && (value & (value - 1)) == 0;
+		}
+
+		//! @brief		Floor of log2(value), for value > 0.
+		constexpr uint8_t Log2(uint32_t value)
+		{
+			return (value <= 1) ? 0 : (uint8_t)(1 + Log2(value >> 1));
+		}
+
+		//! @brief		Rounds value*2^fracBits to the nearest integer.
+		constexpr int32_t ToFixed(double value, uint8_t fracBits)
+		{
+			double scaled = value*(double)((int64_t)1 << fracBits);
+			return (int32_t)(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5);
+		}
+	} // namespace LutMaths
+
+	//! @brief		How a SinCosLut stores its values.
+	enum class LutStorage
+	{
+		FULL_WAVE,		//!< Separate sin and cos tables covering a full turn (2*size entries).
+		QUARTER_WAVE	//!< One sin table covering a quarter turn (size/4 + 1 entries), folded
+						//!< with index symmetry and sign flips. 8x smaller than FULL_WAVE.
+	};
+
+	//! @brief		Compile-time sine and cosine tables for one full turn.
+	//! @details	Sin(i)/Cos(i) return sin/cos of (2*pi*i/size) as a fixed-point number with
+	//!				fracBits bits after the decimal point (the same raw format as
+	//!				Fp::fp<fracBits>::intValue).
+	//!				The tables are constexpr, so they are built by the compiler and placed in
+	//!				read-only data; no initialisation is needed before use.
+	template <uint32_t size, uint8_t fracBits, LutStorage storage = LutStorage::FULL_WAVE>
+	class SinCosLut
+	{
+
+		static_assert(storage == LutStorage::FULL_WAVE, "Unknown LUT storage.");
+		static_assert(size > 0, "LUT size must be at least 1.");
+		static_assert(fracBits <= 30, "fracBits must be <= 30 so that 1.0 fits in an int32_t.");
+
+	public:
+
+		static constexpr uint32_t numEntries = size;
+		static constexpr uint8_t numFracBits = fracBits;
+
+		//! @brief		Bytes of read-only data used by the tables.
+		static constexpr uint32_t numBytes = 2*size*sizeof(int32_t);
+
+		//! @brief		Raw fixed-point sin(2*pi*index/size). index must be < size.
+		static constexpr int32_t Sin(uint32_t index)
+		{
+			return _table.sinValues[index];
+		}
+
+		//! @brief		Raw fixed-point cos(2*pi*index/size). index must be < size.
+		static constexpr int32_t Cos(uint32_t index)
+		{
+			return _table.cosValues[index];
+		}
+
+	private:
+
+		struct Table
+		{
+			int32_t sinValues[size];
+			int32_t cosValues[size];
+
+			constexpr Table() :
+				sinValues(),
+				cosValues()
+			{
+				for(uint32_t i = 0; i < size; i++)
+				{
+					sinValues[i] = LutMaths::ToFixed(LutMaths::SinOfIndex(i, size), fracBits);
+					cosValues[i] = LutMaths::ToFixed(LutMaths::CosOfIndex(i, size), fracBits);
+				}
+			}
+		};
+
+		static constexpr Table _table = Table();
+
+	};
+
+	template <uint32_t size, uint8_t fracBits, LutStorage storage>
+	constexpr typename SinCosLut<size, fracBits, storage>::Table SinCosLut<size, fracBits, storage>::_table;
+
+	//! @brief		Quarter-wave version of SinCosLut, same interface.
+	//! @details	Only sin over [0, pi/2] is stored. Any index is folded into that quadrant:
+	//!					quadrant 0: sin =  T[r]			quadrant 2: sin = -T[r]
+	//!					quadrant 1: sin =  T[q - r]		quadrant 3: sin = -T[q - r]
+	//!				where q = size/4 and r = index % q, and cos(i) = sin(i + q).
+	//!				The folding costs a few integer operations (shifts and masks when size is a
+	//!				power of two) per lookup.
+	template <uint32_t size, uint8_t fracBits>
+	class SinCosLut<size, fracBits, LutStorage::QUARTER_WAVE>
+	{
+
+		static_assert(size >= 4 && size % 4 == 0, "Quarter-wave LUT size must be a multiple of 4.");
+		static_assert(fracBits <= 30, "fracBits must be <= 30 so that 1.0 fits in an int32_t.");
+
+		static constexpr uint32_t quarter = size/4;
+
+	public:
+
+		static constexpr uint32_t numEntries = size;
+		static constexpr uint8_t numFracBits = fracBits;
+
+		//! @brief		Bytes of read-only data used by the table.
+		static constexpr uint32_t numBytes = (quarter + 1)*sizeof(int32_t);
+
+		//! @brief		Raw fixed-point sin(2*pi*index/size). index must be < size.
+		static constexpr int32_t Sin(uint32_t index)
+		{
+			return (index/quarter == 0) ? _table.values[index] :
+				(index/quarter == 1) ? _table.values[2*quarter - index] :
+				(index/quarter == 2) ? -_table.values[index - 2*quarter] :
+				-_table.values[size - index];
+		}
+
+		//! @brief		Raw fixed-point cos(2*pi*index/size). index must be < size.
+		static constexpr int32_t Cos(uint32_t index)
+		{
+			return Sin(index < 3*quarter ? index + quarter : index - 3*quarter);
+		}
+
+	private:
+
+		struct Table
+		{
+			int32_t values[quarter + 1];
+
+			constexpr Table() :
+				values()
+			{
+				for(uint32_t i = 0; i <= quarter; i++)
+					values[i] = LutMaths::ToFixed(LutMaths::SinOfIndex(i, size), fracBits);
+			}
+		};
+
+		static constexpr Table _table = Table();
+
+	};
+
+	template <uint32_t size, uint8_t fracBits>
+	constexpr typename SinCosLut<size, fracBits, LutStorage::QUARTER_WAVE>::Table
+		SinCosLut<size, fracBits, LutStorage::QUARTER_WAVE>::_table;
+
+	//! @brief		How LutSinCos() turns a fractional table position into a value.
+	enum class LutInterpolation
+	{
+		NONE,		//!< Truncate to the entry below the position. Fastest, error up to 2*pi/size.
+		LINEAR		//!< Blend the two adjacent entries using the fractional part of the position.
+					//!< Error about (2*pi/size)^2/8, e.g. 7.5e-5 for a 256 entry table.
+	};
+
+	//! @brief		Looks up the entry at index, and when interpolating blends in the next entry by
+	//!				frac/2^fracBits. index must be < Lut::numEntries.
+	template <class Lut, uint8_t fracBits, LutInterpolation interpolation>
+	inline void LutSinCosAtIndex(uint32_t index, uint32_t frac, int32_t *sinOut, int32_t *cosOut)
+	{
+		int32_t sinValue = Lut::Sin(index);
+		int32_t cosValue = Lut::Cos(index);
+
+		if(interpolation == LutInterpolation::LINEAR && fracBits > 0)
+		{
+			uint32_t nextIndex = (index + 1 == Lut::numEntries) ? 0 : index + 1;
+
+			sinValue += (int32_t)(((int64_t)(Lut::Sin(nextIndex) - sinValue)*frac) >> fracBits);
+			cosValue += (int32_t)(((int64_t)(Lut::Cos(nextIndex) - cosValue)*frac) >> fracBits);
+		}
+
+		*sinOut = sinValue;
+		*cosOut = cosValue;
+	}
+
+	//! @brief		Looks up sin and cos at a fractional position in a SinCosLut.
+	//! @details	position is measured in table entries (one full turn = Lut::numEntries) and has
+	//!				posFracBits bits after the decimal point. Positions outside one turn, including
+	//!				negative ones, are wrapped (a modulo, or a mask when the size is a power of two).
+	//!				Outputs have the same fixed-point format as the Lut.
+	//! @note		Thread-safe.
+	template <class Lut, uint8_t posFracBits, LutInterpolation interpolation>
+	inline void LutSinCos(int32_t position, int32_t *sinOut, int32_t *cosOut)
+	{
+		const int32_t size = (int32_t)Lut::numEntries;
+
+		int32_t index = (position >> posFracBits) % size;
+		if(index < 0)
+			index += size;
+
+		const uint32_t fracMask = ((uint32_t)1 << posFracBits) - 1;
+		LutSinCosAtIndex<Lut, posFracBits, interpolation>((uint32_t)index, (uint32_t)position & fracMask,
+			sinOut, cosOut);
+	}
+
+	//! @brief		Looks up sin and cos of a binary angle in a SinCosLut.
+	//! @details	The table size must be a power of two, then the top bits of the angle are the
+	//!				index (a shift) and the remaining bits are the interpolation fraction. There is no
+	//!				wrapping to do, a binary angle is always within one turn.
+	//!				Outputs have the same fixed-point format as the Lut.
+	//! @note		Thread-safe.
+	template <class Lut, LutInterpolation interpolation, typename T>
+	inline void LutSinCos(BinaryAngle<T> angle, int32_t *sinOut, int32_t *cosOut)
+	{
+		static_assert(LutMaths::IsPowerOfTwo(Lut::numEntries),
+			"Binary angle lookups need a power-of-two LUT size.");
+
+		const uint8_t indexBits = LutMaths::Log2(Lut::numEntries);
+		static_assert(indexBits <= BinaryAngle<T>::numBits,
+			"LUT has more entries than the binary angle has steps.");
+
+		const uint8_t fracBits = BinaryAngle<T>::numBits - indexBits;
+		const uint32_t fracMask = (uint32_t)(((uint64_t)1 << fracBits) - 1);
+		uint32_t index = (uint32_t)((uint64_t)angle.value >> fracBits);
+
+		LutSinCosAtIndex<Lut, fracBits, interpolation>(index, (uint32_t)angle.value & fracMask,
+			sinOut, cosOut);
+	}
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_SIN_COS_LUT_H
+
+// EOF
@@ -0,0 +1,167 @@
+//!
+//! @file 			SpscRing.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Wait-free single-producer/single-consumer ring buffer.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_SPSC_RING_H
+#define PARK_TRANSFORM_SPSC_RING_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Fixed-size ring buffer for one producer thread and one consumer thread.
+	//! @details	Every operation completes in a bounded number of steps (wait-free), with no locks
+	//!				or read-modify-write atomics. The producer's and consumer's indexes live on
+	//!				separate cache lines, and each side keeps a cached copy of the other's index so
+	//!				it only touches the other side's line when the ring looks full/empty.
+	//!				capacity must be a power of two. T must be trivially copyable.
+	template <typename T, uint32_t capacity>
+	class SpscRing
+	{
+		static_assert(capacity >= 2 && (capacity & (capacity - 1)) == 0, "capacity must be a power of two.");
+
+	public:
+
+		static constexpr uint32_t numItems = capacity;
+
+		SpscRing() :
+			_head(0),
+			_cachedTail(0),
+			_tail(0),
+			_cachedHead(0)
+		{
+		}
+
+		SpscRing(const SpscRing &) = delete;
+		SpscRing &operator=(const SpscRing &) = delete;
+
+		//===============================================================================================//
+		//======================================== PRODUCER SIDE ========================================//
+		//===============================================================================================//
+
+		//! @brief		Adds item. Returns false if the ring is full.
+		bool TryPush(const T &item)
+		{
+			uint32_t head = _head.load(std::memory_order_relaxed);
+			if(head - _cachedTail == capacity)
+			{
+				_cachedTail = _tail.load(std::memory_order_acquire);
+				if(head - _cachedTail == capacity)
+					return false;
+			}
+			_items[head & (capacity - 1)] = item;
+			_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		//===============================================================================================//
+		//======================================== CONSUMER SIDE ========================================//
+		//===============================================================================================//
+
+		//! @brief		Removes the oldest item into item. Returns false if the ring is empty.
+		bool TryPop(T *item)
+		{
+			uint32_t tail = _tail.load(std::memory_order_relaxed);
+			if(_cachedHead == tail)
+			{
+				_cachedHead = _head.load(std::memory_order_acquire);
+				if(_cachedHead == tail)
+					return false;
+			}
+			*item = _items[tail & (capacity - 1)];
+			_tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		//! @brief		Points items at the oldest items, and returns how many of them are contiguous
+		//!				(0 if empty). Call Consume() once done with them.
+		//! @details	Unlike TryPop(), always reads the producer's index, so the span covers
+		//!				everything that has arrived (up to the end of the storage).
+		uint32_t Peek(const T **items)
+		{
+			uint32_t tail = _tail.load(std::memory_order_relaxed);
+			_cachedHead = _head.load(std::memory_order_acquire);
+			uint32_t index = tail & (capacity - 1);
+			uint32_t numAvailable = _cachedHead - tail;
+			*items = &_items[index];
+			return (numAvailable < capacity - index) ? numAvailable : capacity - index;
+		}
+
+		//! @brief		Frees the oldest numItems items, which must have been returned by Peek().
+		void Consume(uint32_t numConsumed)
+		{
+			_tail.store(_tail.load(std::memory_order_relaxed) + numConsumed, std::memory_order_release);
+		}
+
+		//===============================================================================================//
+		//========================================== ANY THREAD =========================================//
+		//===============================================================================================//
+
+		//! @brief		Number of items in the ring. Only a snapshot when called from another thread.
+		uint32_t Size() const
+		{
+			// tail first: both only grow and tail never passes head, so head - tail can't wrap.
+			// Both may move between the loads though, so clamp to what the ring can hold.
+			uint32_t tail = _tail.load(std::memory_order_acquire);
+			uint32_t head = _head.load(std::memory_order_acquire);
+			uint32_t size = head - tail;
+			return (size < capacity) ? size : capacity;
+		}
+
+	private:
+
+		//===============================================================================================//
+		//=================================== PRIVATE VARIABLES/STRUCTURES ==============================//
+		//===============================================================================================//
+
+		// Padding keeps the producer's and consumer's indexes on their own cache lines, and off
+		// the lines of whatever is next to the ring in memory
+		char _padding0[64];
+
+		// Producer
+		std::atomic<uint32_t> _head;
+		uint32_t _cachedTail;
+		char _padding1[64];
+
+		// Consumer
+		std::atomic<uint32_t> _tail;
+		uint32_t _cachedHead;
+		char _padding2[64];
+
+		T _items[capacity];
+
+	};
+
+	template <typename T, uint32_t capacity> constexpr uint32_t SpscRing<T, capacity>::numItems;
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_SPSC_RING_H
+
+// EOF
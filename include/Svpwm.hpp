@@ -0,0 +1,91 @@
+//!
+//! @file 			Svpwm.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Space-vector PWM duty cycle generation (min-max injection).
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_SVPWM_H
+#define PARK_TRANSFORM_SVPWM_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// User includes
+#include "Frames.hpp"
+#include "Scalar.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Limits value to [low, high].
+	template <typename T>
+	inline T SvpwmClamp(T value, T low, T high)
+	{
+		typedef ScalarTraits<T> S;
+		value = S::Less(value, low) ? low : value;
+		return S::Less(high, value) ? high : value;
+	}
+
+	//! @brief		Converts a stationary alpha-beta voltage into three phase duty cycles.
+	//! @details	alpha and beta are normalised to the DC link voltage. The phase voltages come
+	//!				from the inverse Clarke transform:
+	//!					va = alpha
+	//!					vb = -alpha/2 + (sqrt(3)/2)*beta
+	//!					vc = -alpha/2 - (sqrt(3)/2)*beta
+	//!				then the min-max common mode is subtracted (equivalent to SVPWM with centred
+	//!				zero vectors):
+	//!					duty = 1/2 + v - (max(va, vb, vc) + min(va, vb, vc))/2
+	//!				The linear range is |alpha + j*beta| <= 1/sqrt(3). Beyond that the duties are
+	//!				clamped to [0, 1] (Q15/Q31 saturate just below 1).
+	//!	@note		Thread-safe.
+	template <typename T>
+	inline Abc<T> SvpwmDuties(T alpha, T beta)
+	{
+		typedef ScalarTraits<T> S;
+		const T half = S::FromDouble(0.5);
+		const T halfSqrt3 = S::FromDouble(0.86602540378443864676);
+		const T zero = S::FromDouble(0.0);
+		const T one = S::FromDouble(1.0);
+
+		T halfAlpha = S::Mul(alpha, half);
+		T betaTerm = S::Mul(beta, halfSqrt3);
+		T va = alpha;
+		T vb = S::Sub(betaTerm, halfAlpha);
+		T vc = S::Sub(S::Sub(zero, halfAlpha), betaTerm);
+
+		T vMax = S::Less(va, vb) ? vb : va;
+		vMax = S::Less(vMax, vc) ? vc : vMax;
+		T vMin = S::Less(vb, va) ? vb : va;
+		vMin = S::Less(vc, vMin) ? vc : vMin;
+
+		// Offset that centres the phase voltages in the [0, 1] duty range
+		T offset = S::Sub(half, S::Add(S::Mul(vMax, half), S::Mul(vMin, half)));
+
+		return Abc<T>{
+			SvpwmClamp(S::Add(va, offset), zero, one),
+			SvpwmClamp(S::Add(vb, offset), zero, one),
+			SvpwmClamp(S::Add(vc, offset), zero, one) };
+	}
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_SVPWM_H
+
+// EOF
@@ -0,0 +1,115 @@
+//!
+//! @file 			ThreadPool.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Work-stealing thread pool for running a function over many independent chunks.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_THREAD_POOL_H
+#define PARK_TRANSFORM_THREAD_POOL_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		Runs func(context, chunkIndex) for every chunk index, spread over a fixed set of
+	//!				threads.
+	//! @details	Each thread starts with an equal, contiguous range of chunk indexes and takes
+	//!				them from the front. A thread that runs out steals the back half of another
+	//!				thread's remaining range, so uneven chunk costs (or a thread being descheduled)
+	//!				balance out without any locks on the hot path. Ranges are a packed 64-bit
+	//!				atomic (begin, end) per thread, updated by compare-and-swap.
+	//!				The calling thread works too, so a pool of 1 runs everything inline.
+	class WorkStealingPool
+	{
+
+	public:
+
+		typedef void (*ChunkFunc)(void *context, uint32_t chunkIndex);
+
+		//! @brief		Starts numThreads - 1 worker threads. 0 uses one per hardware thread.
+		explicit WorkStealingPool(unsigned numThreads = 0);
+
+		//! @brief		Stops and joins the worker threads.
+		~WorkStealingPool();
+
+		WorkStealingPool(const WorkStealingPool &) = delete;
+		WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+		//! @brief		Number of threads that run chunks, including the caller of Run().
+		unsigned GetNumThreads() const { return (unsigned)_queues.size(); }
+
+		//! @brief		Runs func for chunk indexes 0 to numChunks - 1, each exactly once, and returns
+		//!				when all are done. Chunks run in no particular order or thread.
+		//! @note		Not re-entrant, call from one thread at a time.
+		void Run(ChunkFunc func, void *context, uint32_t numChunks);
+
+	private:
+
+		//! One thread's remaining chunks, on its own cache line
+		struct Queue
+		{
+			std::atomic<uint64_t> range;	//!< begin << 32 | end
+			char padding[64 - sizeof(std::atomic<uint64_t>)];
+		};
+
+		void WorkerMain(unsigned index);
+
+		//! Runs chunks from queue index, then steals, until there are none left anywhere
+		void Work(unsigned index);
+
+		bool PopFront(Queue &queue, uint32_t *chunkIndex);
+		bool StealHalf(unsigned thiefIndex, uint32_t *chunkIndex);
+
+		//===============================================================================================//
+		//=================================== PRIVATE VARIABLES/STRUCTURES ==============================//
+		//===============================================================================================//
+
+		std::vector<Queue> _queues;
+		std::vector<std::thread> _threads;
+
+		// The current job
+		ChunkFunc _func;
+		void *_context;
+
+		std::mutex _mutex;
+		std::condition_variable _startCondition;
+		std::condition_variable _doneCondition;
+		uint64_t _generation;		//!< Incremented for each Run(), guarded by _mutex
+		unsigned _numWorking;		//!< Workers still in the current job, guarded by _mutex
+		bool _stop;
+
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_THREAD_POOL_H
+
+// EOF
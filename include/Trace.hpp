@@ -0,0 +1,64 @@
+//!
+//! @file 			Trace.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Trace (instrumentation) policies for BasicTransformer.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_TRACE_H
+#define PARK_TRANSFORM_TRACE_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		The calls a trace policy is told about.
+	enum class TraceEvent
+	{
+		CALC_ROTATION,		//!< sin/cos evaluated (every theta overload goes through this)
+		FORWARD,
+		INVERSE,
+		FORWARD_FROM_ABC,	//!< ForwardFromABC() and ForwardFromAB()
+		INVERSE_SVPWM,
+		REFRAME
+	};
+
+	//! Number of TraceEvent values
+	static const int numTraceEvents = 6;
+
+	//! @brief		The default trace policy, which records nothing and compiles to nothing.
+	//! @details	A trace policy provides:
+	//!					Scope(TraceEvent), constructed for the duration of each traced call
+	//!					template <class AnglePolicy> static void OnAngle(angle_type theta),
+	//!						called with every angle sin/cos is evaluated for
+	//!				See TraceRecorder.hpp for RecordingTrace, which records them.
+	struct NullTrace
+	{
+		struct Scope
+		{
+			explicit Scope(TraceEvent) {}
+		};
+
+		template <class AnglePolicy>
+		static void OnAngle(typename AnglePolicy::angle_type) {}
+	};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_TRACE_H
+
+// EOF
@@ -0,0 +1,278 @@
+//!
+//! @file 			TraceRecorder.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			A trace policy that records call counts, an angle (LUT index) histogram and
+//!					sampled cycle counts into per-thread buffers, drained to a user sink.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_TRACE_RECORDER_H
+#define PARK_TRANSFORM_TRACE_RECORDER_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#if(configPARK_TRACE_DRAIN_THREAD == 1)
+	#include <thread>
+#endif
+
+#if !defined(configPARK_TRACE_READ_CYCLES) && (defined(__x86_64__) || defined(__i386__))
+	#include <x86intrin.h>		// __rdtsc()
+#endif
+
+// User includes
+#include "Config.hpp"
+#include "BinaryAngle.hpp"
+#include "Trace.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	static_assert((configPARK_TRACE_RING_SIZE & (configPARK_TRACE_RING_SIZE - 1)) == 0,
+		"configPARK_TRACE_RING_SIZE must be a power of two.");
+
+	//! @brief		Reads the cycle counter used to time the sampled calls (low 32 bits).
+	inline uint32_t TraceReadCycles()
+	{
+		#if defined(configPARK_TRACE_READ_CYCLES)
+			return (uint32_t)configPARK_TRACE_READ_CYCLES();
+		#elif defined(__x86_64__) || defined(__i386__)
+			return (uint32_t)__rdtsc();
+		#elif defined(__aarch64__)
+			uint64_t count;
+			__asm__ volatile("mrs %0, cntvct_el0" : "=r"(count));
+			return (uint32_t)count;
+		#else
+			return 0;
+		#endif
+	}
+
+	class TraceSink;
+	bool DrainTrace(TraceSink &sink);
+
+	//! @brief		The duration of one sampled call.
+	struct TraceCycleSample
+	{
+		TraceEvent event;
+		uint32_t cycles;
+	};
+
+	//! @brief		One thread's trace records.
+	//! @details	Written only by the owning thread, without locks or read-modify-write atomics
+	//!				(each counter has a single writer, so a relaxed load and store is enough).
+	//!				Read by DrainTrace() from any thread. Counters are 32-bit and wrap, so drain at
+	//!				least every 2^32 calls. Buffers are never freed; when a thread exits its buffer
+	//!				is kept (so nothing recorded is lost) and reused by the next new thread.
+	class TraceBuffer
+	{
+
+	public:
+
+		//! @brief		Returns the calling thread's buffer, claiming one on first use.
+		static TraceBuffer &Local()
+		{
+			static thread_local TraceBuffer *buffer = nullptr;
+			if(!buffer)
+				buffer = Acquire();
+			return *buffer;
+		}
+
+		void Count(TraceEvent event)
+		{
+			Increment(_callCounts[(int)event]);
+		}
+
+		void CountAngle(Bam32 theta)
+		{
+			Increment(_histogram[((uint64_t)theta.value*configPARK_TRACE_HISTOGRAM_BINS) >> 32]);
+		}
+
+		//! @brief		Returns true once every configPARK_TRACE_SAMPLE_INTERVAL calls.
+		bool StartSample()
+		{
+			if(++_untilSample < configPARK_TRACE_SAMPLE_INTERVAL)
+				return false;
+			_untilSample = 0;
+			return true;
+		}
+
+		//! @brief		Queues a sample for the drain. Dropped (and counted) if the queue is full.
+		void PushSample(TraceEvent event, uint32_t cycles)
+		{
+			uint32_t head = _head.load(std::memory_order_relaxed);
+			if(head - _tail.load(std::memory_order_acquire) == configPARK_TRACE_RING_SIZE)
+			{
+				Increment(_numDropped);
+				return;
+			}
+			TraceCycleSample &sample = _samples[head & (configPARK_TRACE_RING_SIZE - 1)];
+			sample.event = event;
+			sample.cycles = cycles;
+			_head.store(head + 1, std::memory_order_release);
+		}
+
+	private:
+
+		friend bool DrainTrace(TraceSink &sink);
+
+		TraceBuffer();
+
+		static TraceBuffer *Acquire();
+
+		static void Increment(std::atomic<uint32_t> &counter)
+		{
+			counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+
+		//===============================================================================================//
+		//=================================== PRIVATE VARIABLES/STRUCTURES ==============================//
+		//===============================================================================================//
+
+		// Written by the owning thread
+		std::atomic<uint32_t> _callCounts[numTraceEvents];
+		std::atomic<uint32_t> _histogram[configPARK_TRACE_HISTOGRAM_BINS];
+		std::atomic<uint32_t> _numDropped;
+		uint32_t _untilSample;
+		char _padding0[64];		// Keeps the queue indexes off each other's cache line
+		std::atomic<uint32_t> _head;
+		TraceCycleSample _samples[configPARK_TRACE_RING_SIZE];
+
+		// Written by the drain
+		char _padding1[64];
+		std::atomic<uint32_t> _tail;
+		uint32_t _drainedCallCounts[numTraceEvents];
+		uint32_t _drainedHistogram[configPARK_TRACE_HISTOGRAM_BINS];
+		uint32_t _drainedNumDropped;
+
+		// Registry of every buffer
+		std::atomic<bool> _owned;
+		TraceBuffer *_next;
+		uint32_t _index;
+
+	};
+
+	//! @brief		What one thread recorded since the previous drain.
+	struct TraceSnapshot
+	{
+		uint32_t bufferIndex;		//!< Stable id of the buffer (reused after its thread exits)
+		uint32_t callCounts[numTraceEvents];
+		//! Angles traced, in configPARK_TRACE_HISTOGRAM_BINS equal parts of a turn. For a LUT
+		//! of N entries, bin i holds LUT indexes i*N/bins to (i + 1)*N/bins - 1.
+		uint32_t histogram[configPARK_TRACE_HISTOGRAM_BINS];
+		uint32_t numDroppedSamples;
+		const TraceCycleSample *samples;
+		size_t numSamples;
+	};
+
+	//! @brief		Receives drained trace records. Implement this to log, print or plot them.
+	class TraceSink
+	{
+	public:
+		virtual ~TraceSink() {}
+
+		//! @brief		Called by DrainTrace() for each buffer with anything new.
+		virtual void OnTrace(const TraceSnapshot &snapshot) = 0;
+	};
+
+	//! @brief		Moves everything recorded since the last call into sink, one snapshot per thread.
+	//! @details	Call from any thread, e.g. a low priority task or idle loop, never from the traced
+	//!				calls. Returns false, without draining, if another drain is running.
+	bool DrainTrace(TraceSink &sink);
+
+	//! @brief		Trace policy recording into the calling thread's TraceBuffer.
+	//! @details	Use as the last template parameter of BasicTransformer, or set configPARK_TRACE to
+	//!				1 to use it in Transformer. Each traced call costs a thread-local lookup and a
+	//!				couple of stores, plus two cycle counter reads on sampled calls.
+	struct RecordingTrace
+	{
+		class Scope
+		{
+		public:
+			explicit Scope(TraceEvent event) :
+				_buffer(TraceBuffer::Local()),
+				_event(event),
+				_sampled(false),
+				_startCycles(0)
+			{
+				_buffer.Count(event);
+				if(_buffer.StartSample())
+				{
+					_sampled = true;
+					_startCycles = TraceReadCycles();
+				}
+			}
+
+			~Scope()
+			{
+				if(_sampled)
+					_buffer.PushSample(_event, TraceReadCycles() - _startCycles);
+			}
+
+			Scope(const Scope &) = delete;
+			Scope &operator=(const Scope &) = delete;
+
+		private:
+			TraceBuffer &_buffer;
+			TraceEvent _event;
+			bool _sampled;
+			uint32_t _startCycles;
+		};
+
+		template <class AnglePolicy>
+		static void OnAngle(typename AnglePolicy::angle_type theta)
+		{
+			TraceBuffer &buffer = TraceBuffer::Local();
+			buffer.Count(TraceEvent::CALC_ROTATION);
+			buffer.CountAngle(AnglePolicy::ToBam32(theta));
+		}
+	};
+
+	#if(configPARK_TRACE_DRAIN_THREAD == 1)
+		//! @brief		Calls DrainTrace() every periodMs on a background thread, and once more when
+		//!				destroyed (so nothing recorded before then is lost).
+		//! @details	sink is called from the background thread only.
+		class TraceDrainThread
+		{
+		public:
+			TraceDrainThread(TraceSink &sink, unsigned periodMs);
+			~TraceDrainThread();
+
+			TraceDrainThread(const TraceDrainThread &) = delete;
+			TraceDrainThread &operator=(const TraceDrainThread &) = delete;
+
+		private:
+			void Run();
+
+			TraceSink &_sink;
+			unsigned _periodMs;
+			std::atomic<bool> _stop;
+			std::thread _thread;
+		};
+	#endif
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_TRACE_RECORDER_H
+
+// EOF
@@ -3,7 +3,7 @@
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @edited 		n/a
 //! @created		2012/10/10
-//! @last-modified 	2014/01/21
+//! @last-modified 	2026/10/17
 //! @brief 			Header file for ParkTransform.cpp
 //! @details
 //!					See README.rst
@@ -19,6 +19,36 @@
 	#error Please build with C++ compiler
 #endif
 
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stddef.h>		// size_t
+
+// User includes
+#include "Config.hpp"
+#include "BinaryAngle.hpp"
+#include "Rotation.hpp"
+#include "Scalar.hpp"		// Also includes fixed-point-cpp, if enabled
+#include "Frames.hpp"
+#include "BasicTransformer.hpp"
+#include "RotationStream.hpp"
+#include "PolySinCos.hpp"
+#include "Simd.hpp"
+#include "Trace.hpp"
+
+#if(configPARK_TRACE == 1)
+	#include "TraceRecorder.hpp"
+#endif
+
+// The fixed-point binary angle methods index the LUT with a shift (CORDIC has no LUT)
+#if(((configPARK_LUT_SIZE) & ((configPARK_LUT_SIZE) - 1)) == 0) || (configPARK_USE_CORDIC == 1)
+	#define PARK_TRANSFORM_FIXED_BAM_FUNCTIONS 1
+#else
+	#define PARK_TRANSFORM_FIXED_BAM_FUNCTIONS 0
+#endif
+
 //===============================================================================================//
 //======================================== NAMESPACE ============================================//
 //===============================================================================================//
@@ -26,6 +56,10 @@
 namespace ParkTransform
 {
 
+	//! @brief		Park transformer for doubles and, if enabled, Fp::fp<CDP>.
+	//! @details	A thin wrapper around the header-only BasicTransformer kernels (see
+	//!				BasicTransformer.hpp), plus the SIMD batch functions. Use BasicTransformer
+	//!				directly for other scalar types, angle types or trig implementations.
 	class Transformer
 	{
 
@@ -34,10 +68,14 @@ namespace ParkTransform
 		//===================================== PUBLIC METHOD PROTOTYPES ================================//
 		//===============================================================================================//
 
+		//! @brief		Does nothing. The sin/cos LUT's used by the fixed-point functions are now
+		//!				generated at compile time (see SinCosLut.hpp), so no initialisation is needed.
+		//! @deprecated	Kept so existing code still compiles.
+		//! @public
 		void Init();
 
 		//! @brief 		Converts from stationary alpha-beta to rotating d-q reference frame
-		//! @warning	Slow! Uses doubles and sin function
+		//! @warning	Slow compared to the fixed-point functions. Uses doubles and one fused sincos() evaluation.
 		//! @note		Thread-safe.
 		//! @public
 		void Forward(double alpha, double beta, double theta,
@@ -45,35 +83,282 @@ namespace ParkTransform
 
 		//! @brief 		Converts from rotating d-q reference frame to stationary alpha-beta
 		//! @details
-		//! @warning	Slow! Uses doubles and sin function
+		//! @warning	Slow compared to the fixed-point functions. Uses doubles and one fused sincos() evaluation.
 		//! @public
 		void Inverse(double d, double q, double theta,
 			double *alpha, double *beta);
 
+		//! @brief 		Calculates cos(theta) and sin(theta) once, for re-use across many
+		//!				Forward()/Inverse() calls at the same angle.
+		//! @note		Thread-safe.
+		//! @public
+		Rotation<double> CalcRotation(double theta);
+
+		//! @brief 		Calculates the rotation for a binary angle (fraction of a turn).
+		//! @details	Bam16 angles are converted implicitly.
+		//! @note		Thread-safe.
+		//! @public
+		Rotation<double> CalcRotation(Bam32 theta);
+
+		//! @brief 		Forward() with theta as a binary angle, e.g. straight from an encoder.
+		//! @note		Thread-safe.
+		//! @public
+		void Forward(double alpha, double beta, Bam32 theta,
+			double *d, double *q);
+
+		//! @brief 		Inverse() with theta as a binary angle, e.g. straight from an encoder.
+		//! @note		Thread-safe.
+		//! @public
+		void Inverse(double d, double q, Bam32 theta,
+			double *alpha, double *beta);
+
+		//! @brief 		Converts from stationary alpha-beta to rotating d-q reference frame, using
+		//!				a precomputed rotation.
+		//! @details	Gives bit-for-bit the same results as Forward(alpha, beta, theta, d, q) when
+		//!				rotation came from CalcRotation(theta), without evaluating any trig.
+		//! @note		Thread-safe.
+		//! @public
+		void Forward(double alpha, double beta, const Rotation<double> &rotation,
+			double *d, double *q);
+
+		//! @brief 		Converts from rotating d-q reference frame to stationary alpha-beta, using
+		//!				a precomputed rotation.
+		//! @details	Gives bit-for-bit the same results as Inverse(d, q, theta, alpha, beta) when
+		//!				rotation came from CalcRotation(theta), without evaluating any trig.
+		//! @note		Thread-safe.
+		//! @public
+		void Inverse(double d, double q, const Rotation<double> &rotation,
+			double *alpha, double *beta);
+
+		//! @brief 		Forward(), returning d and q by value.
+		//! @details	Defined in this header when config_PARK_TRANSFORM_HEADER_ONLY is 1, so the
+		//!				compiler can inline it into the control loop.
+		//! @note		Thread-safe.
+		//! @public
+		Dq<double> Forward(double alpha, double beta, double theta);
+
+		//! @brief 		Forward() using a precomputed rotation, returning d and q by value.
+		//! @note		Thread-safe.
+		//! @public
+		Dq<double> Forward(double alpha, double beta, const Rotation<double> &rotation);
+
+		//! @brief 		Inverse(), returning alpha and beta by value.
+		//! @note		Thread-safe.
+		//! @public
+		AlphaBeta<double> Inverse(double d, double q, double theta);
+
+		//! @brief 		Inverse() using a precomputed rotation, returning alpha and beta by value.
+		//! @note		Thread-safe.
+		//! @public
+		AlphaBeta<double> Inverse(double d, double q, const Rotation<double> &rotation);
+
+		//! @brief 		Converts three-phase quantities straight to the rotating d-q-0 frame.
+		//! @details	Fuses the Clarke transform (amplitude invariant) into Forward(), with one sincos()
+		//!				and no intermediate alpha/beta. See BasicTransformer::ForwardFromABC().
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardFromABC(double a, double b, double c, double theta,
+			double *d, double *q, double *zero);
+
+		//! @brief 		ForwardFromABC(), returning d, q and zero by value.
+		//! @note		Thread-safe.
+		//! @public
+		Dq0<double> ForwardFromABC(double a, double b, double c, double theta);
+
+		//! @brief 		ForwardFromABC() for two phase sensors, with c = -a - b.
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardFromAB(double a, double b, double theta, double *d, double *q);
+
+		//! @brief 		ForwardFromAB(), returning d and q by value.
+		//! @note		Thread-safe.
+		//! @public
+		Dq<double> ForwardFromAB(double a, double b, double theta);
+
+		//! @brief 		Inverse() followed by space-vector PWM (min-max injection), giving the three
+		//!				phase duty cycles in [0, 1] directly.
+		//! @details	d and q are normalised to the DC link voltage. See SvpwmDuties().
+		//! @note		Thread-safe.
+		//! @public
+		void InverseSvpwm(double d, double q, double theta,
+			double *dutyA, double *dutyB, double *dutyC);
+
+		//! @brief 		InverseSvpwm(), returning the duties by value.
+		//! @note		Thread-safe.
+		//! @public
+		Abc<double> InverseSvpwm(double d, double q, double theta);
+
+		//! @brief 		Re-references d-q from the frame at thetaFrom to the frame at thetaTo, e.g. for
+		//!				a sensor offset, another pole pair count or an observer's angle.
+		//! @details	The same as Inverse() at thetaFrom then Forward() at thetaTo, as a single
+		//!				rotation by thetaTo - thetaFrom (one sin/cos instead of two). See
+		//!				BasicTransformer::Reframe().
+		//! @note		Thread-safe.
+		//! @public
+		void Reframe(double d, double q, double thetaFrom, double thetaTo, double *dOut, double *qOut);
+
+		//! @brief 		Reframe(), returning d and q by value.
+		//! @note		Thread-safe.
+		//! @public
+		Dq<double> Reframe(double d, double q, double thetaFrom, double thetaTo);
+
+		//! @brief 		Converts numSamples samples from stationary alpha-beta to rotating d-q reference frame.
+		//! @details	Same maths as Forward(), applied element-wise over contiguous arrays in a single
+		//!				call. Uses the widest SIMD kernel the CPU supports (see Simd.hpp). Results match
+		//!				calling Forward() on each sample to within 1e-12*(|alpha| + |beta|).
+		//!				d may alias alpha and q may alias beta (in-place transform).
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardBatch(const double *alpha, const double *beta, const double *theta,
+			double *d, double *q, size_t numSamples);
+
+		//! @brief 		Float version of ForwardBatch(). Results are within 1e-5*(|alpha| + |beta|)
+		//!				of the double version.
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardBatch(const float *alpha, const float *beta, const float *theta,
+			float *d, float *q, size_t numSamples);
+
+		//! @brief 		Converts numSamples samples from rotating d-q reference frame to stationary alpha-beta.
+		//! @details	Same maths as Inverse(), applied element-wise over contiguous arrays in a single
+		//!				call. Uses the widest SIMD kernel the CPU supports (see Simd.hpp). Results match
+		//!				calling Inverse() on each sample to within 1e-12*(|d| + |q|).
+		//!				alpha may alias d and beta may alias q (in-place transform).
+		//! @note		Thread-safe.
+		//! @public
+		void InverseBatch(const double *d, const double *q, const double *theta,
+			double *alpha, double *beta, size_t numSamples);
+
+		//! @brief 		Float version of InverseBatch(). Results are within 1e-5*(|d| + |q|)
+		//!				of the double version.
+		//! @note		Thread-safe.
+		//! @public
+		void InverseBatch(const float *d, const float *q, const float *theta,
+			float *alpha, float *beta, size_t numSamples);
+
+		//! @brief		Forward() with sin/cos from PolySinCos() to the given accuracy tier, e.g.
+		//!				Forward<PolyAccuracy::LOW>(...). Pick the cheapest tier each call site can use.
+		//! @public
+		template <PolyAccuracy accuracy>
+		void Forward(double alpha, double beta, double theta, double *d, double *q)
+		{
+			BasicTransformer<double, RadianAngle<double>, PolyTrig<accuracy> >::Forward(alpha, beta, theta, d, q);
+		}
+
+		//! @brief		Inverse() with sin/cos to the given accuracy tier.
+		//! @public
+		template <PolyAccuracy accuracy>
+		void Inverse(double d, double q, double theta, double *alpha, double *beta)
+		{
+			BasicTransformer<double, RadianAngle<double>, PolyTrig<accuracy> >::Inverse(d, q, theta, alpha, beta);
+		}
+
+		//! @brief		ForwardBatch() with sin/cos to the given accuracy tier (double or float).
+		//! @note		Thread-safe.
+		//! @public
+		template <PolyAccuracy accuracy, typename T>
+		void ForwardBatch(const T *alpha, const T *beta, const T *theta, T *d, T *q, size_t numSamples)
+		{
+			Simd::ForwardBatch(Simd::GetBestIsa(), accuracy, alpha, beta, theta, d, q, numSamples);
+		}
+
+		//! @brief		InverseBatch() with sin/cos to the given accuracy tier (double or float).
+		//! @note		Thread-safe.
+		//! @public
+		template <PolyAccuracy accuracy, typename T>
+		void InverseBatch(const T *d, const T *q, const T *theta, T *alpha, T *beta, size_t numSamples)
+		{
+			Simd::InverseBatch(Simd::GetBestIsa(), accuracy, d, q, theta, alpha, beta, numSamples);
+		}
+
+		//! @brief 		ForwardFromABC() over arrays, using the widest SIMD kernel the CPU supports.
+		//! @details	zero may be NULL if it is not needed. Outputs may alias inputs.
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardFromABCBatch(const double *a, const double *b, const double *c, const double *theta,
+			double *d, double *q, double *zero, size_t numSamples);
+
+		//! @brief 		Float version of ForwardFromABCBatch().
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardFromABCBatch(const float *a, const float *b, const float *c, const float *theta,
+			float *d, float *q, float *zero, size_t numSamples);
+
+		//! @brief 		ForwardFromAB() over arrays, using the widest SIMD kernel the CPU supports.
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardFromABBatch(const double *a, const double *b, const double *theta,
+			double *d, double *q, size_t numSamples);
+
+		//! @brief 		Float version of ForwardFromABBatch().
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardFromABBatch(const float *a, const float *b, const float *theta,
+			float *d, float *q, size_t numSamples);
+
+		//! @brief 		Reframe() over arrays, using the SIMD ForwardBatch() kernel on the angle
+		//!				differences. dOut may alias d and qOut may alias q.
+		//! @note		Thread-safe.
+		//! @public
+		void ReframeBatch(const double *d, const double *q, const double *thetaFrom, const double *thetaTo,
+			double *dOut, double *qOut, size_t numSamples);
+
+		//! @brief 		Float version of ReframeBatch().
+		//! @note		Thread-safe.
+		//! @public
+		void ReframeBatch(const float *d, const float *q, const float *thetaFrom, const float *thetaTo,
+			float *dOut, float *qOut, size_t numSamples);
+
+		//! @brief 		Forward() over arrays sampled at constant speed, i.e. theta[i] = theta0 + i*deltaTheta.
+		//! @details	sin/cos come from a RotationStream (phasor recurrence, see RotationStream.hpp)
+		//!				instead of being evaluated per sample. Results are within
+		//!				2e-13*(|alpha| + |beta|) of Forward(). d may alias alpha and q may alias beta.
+		//! @note		Thread-safe.
+		//! @public
+		void ForwardStream(const double *alpha, const double *beta, double theta0, double deltaTheta,
+			double *d, double *q, size_t numSamples);
+
+		//! @brief 		Inverse() over arrays sampled at constant speed, see ForwardStream().
+		//! @note		Thread-safe.
+		//! @public
+		void InverseStream(const double *d, const double *q, double theta0, double deltaTheta,
+			double *alpha, double *beta, size_t numSamples);
+
+		//! @brief 		InverseSvpwm() over arrays, for simulating many PWM periods.
+		//! @details	Runs the SIMD InverseBatch() kernel over cache-sized chunks, then the duty
+		//!				calculation over each chunk while it is still in L1. Outputs may alias inputs.
+		//!				The gain over InverseBatch() and a separate duty pass is small: SvpwmBench
+		//!				(64k samples, AVX-512) measured 5.00 vs 5.15 ns/sample.
+		//! @note		Thread-safe.
+		//! @public
+		void InverseSvpwmBatch(const double *d, const double *q, const double *theta,
+			double *dutyA, double *dutyB, double *dutyC, size_t numSamples);
+
 		#if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
 			//! @brief 		Converts from stationary alpha-beta to rotating d-q reference frame.
-			//! @details 	Uses fixed-point numbers and sin/cos LUT's. Call ParkTransform::Init() before
-			//!				calling this function.							\n
+			//! @details 	Uses fixed-point numbers and sin/cos LUT's. theta is measured in LUT
+			//!				entries, i.e. configPARK_LUT_SIZE is one full turn, and is wrapped.	\n
 			//! 			Maths:											\n
 			//!						d = alpha*cos(theta) + beta*sin(theta)	\n
 			//! 					q = beta*cos(theta) - alpha*sin(theta)	\n
-			//!	@note		Execution Time: 192 clock cycles (4us @ 48MHz) (including function call)
+			//!	@note		Execution Time: 192 clock cycles (4us @ 48MHz) (including function call), as
+			//!				originally measured. Run 'make bench' (SweepBench) for your own target.
 			//! @note		Thread-safe.
 			//! @public
 			void Forward(
 				Fp::fp<CDP> alpha,
 				Fp::fp<CDP> beta,
 				Fp::fp<CDP> theta,
-				fp<CDP> *d,
-				fp<CDP> *q);
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q);
 
 			//! @brief 		Converts from rotating d-q reference frame to stationary alpha-beta
-			//! @details	Uses fixed-point mathematics.
-			//!				Call ParkTransform::Init() before calling this function.	\n
+			//! @details	Uses fixed-point mathematics and sin/cos LUT's.			\n
 			//!					Maths:									\n
 			//!					alpha = d*cos(theta) - q*sin(theta)		\n
 			//! 				beta  = q*cos(theta) + d*sin(theta)		\n
-			//! @note		Execution Time: 144 clock cycles (3us @ 48MHz) (including function call)
+			//! @note		Execution Time: 144 clock cycles (3us @ 48MHz) (including function call), as
+			//!				originally measured. Run 'make bench' (SweepBench) for your own target.
 			//! @note		Thread-safe
 			//! @public
 			void Inverse(
@@ -82,15 +367,274 @@ namespace ParkTransform
 				Fp::fp<CDP> theta,
 				Fp::fp<CDP> *alpha,
 				Fp::fp<CDP> *beta);
+
+			//! @brief 		Looks up cos(theta) and sin(theta) once, for re-use across many
+			//!				fixed-point Forward()/Inverse() calls at the same angle.
+			//! @details	Uses the same LUT entry as Forward(alpha, beta, theta, d, q), so with the
+			//!				LUT the rotation overloads give bit-for-bit the same results as the theta
+			//!				ones. With configPARK_USE_CORDIC 1 there is no LUT: Forward()/Inverse() of
+			//!				theta turn the vector inside the CORDIC loop, while the rotation overloads
+			//!				multiply by these sin/cos, so the two can differ by a few LSB's.
+			//! @note		Thread-safe.
+			//! @public
+			Rotation<Fp::fp<CDP> > CalcRotation(Fp::fp<CDP> theta);
+
+			#if(PARK_TRANSFORM_FIXED_BAM_FUNCTIONS == 1)
+			//! @brief 		Looks up the rotation for a binary angle (fraction of a turn).
+			//! @details	The LUT is indexed with a shift, so configPARK_LUT_SIZE must be a power
+			//!				of two (or configPARK_USE_CORDIC 1). Bam16 angles are converted implicitly.
+			//! @note		Thread-safe.
+			//! @public
+			Rotation<Fp::fp<CDP> > CalcRotationFp(Bam32 theta);
+
+			//! @brief 		Fixed-point Forward() with theta as a binary angle.
+			//! @note		Thread-safe.
+			//! @public
+			void Forward(
+				Fp::fp<CDP> alpha,
+				Fp::fp<CDP> beta,
+				Bam32 theta,
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q);
+
+			//! @brief 		Fixed-point Inverse() with theta as a binary angle.
+			//! @note		Thread-safe.
+			//! @public
+			void Inverse(
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				Bam32 theta,
+				Fp::fp<CDP> *alpha,
+				Fp::fp<CDP> *beta);
+			#endif
+
+			//! @brief 		Fixed-point Forward() using a precomputed rotation.
+			//! @details	Bit-exact with Forward() of theta with the LUT, not with CORDIC (see
+			//!				CalcRotation()).
+			//! @note		Thread-safe.
+			//! @public
+			void Forward(
+				Fp::fp<CDP> alpha,
+				Fp::fp<CDP> beta,
+				const Rotation<Fp::fp<CDP> > &rotation,
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q);
+
+			//! @brief 		Fixed-point Inverse() using a precomputed rotation.
+			//! @details	Bit-exact with Inverse() of theta with the LUT, not with CORDIC (see
+			//!				CalcRotation()).
+			//! @note		Thread-safe.
+			//! @public
+			void Inverse(
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				const Rotation<Fp::fp<CDP> > &rotation,
+				Fp::fp<CDP> *alpha,
+				Fp::fp<CDP> *beta);
+
+			//! @brief 		Fixed-point ForwardFromABC(), theta measured in LUT entries.
+			//! @details	Uses the same LUT lookup as the fixed-point Forward().
+			//! @note		Thread-safe.
+			//! @public
+			void ForwardFromABC(
+				Fp::fp<CDP> a,
+				Fp::fp<CDP> b,
+				Fp::fp<CDP> c,
+				Fp::fp<CDP> theta,
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q,
+				Fp::fp<CDP> *zero);
+
+			//! @brief 		Fixed-point ForwardFromAB() (c = -a - b), theta measured in LUT entries.
+			//! @note		Thread-safe.
+			//! @public
+			void ForwardFromAB(
+				Fp::fp<CDP> a,
+				Fp::fp<CDP> b,
+				Fp::fp<CDP> theta,
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q);
+
+			//! @brief 		Fixed-point InverseSvpwm(), theta measured in LUT entries.
+			//! @details	d and q are normalised to the DC link voltage. Duties are in [0, 1].
+			//! @note		Thread-safe.
+			//! @public
+			void InverseSvpwm(
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				Fp::fp<CDP> theta,
+				Fp::fp<CDP> *dutyA,
+				Fp::fp<CDP> *dutyB,
+				Fp::fp<CDP> *dutyC);
+
+			//! @brief 		Fixed-point Reframe(), thetaFrom and thetaTo measured in LUT entries.
+			//! @details	The difference is wrapped to one turn, so it never saturates.
+			//! @note		Thread-safe.
+			//! @public
+			void Reframe(
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				Fp::fp<CDP> thetaFrom,
+				Fp::fp<CDP> thetaTo,
+				Fp::fp<CDP> *dOut,
+				Fp::fp<CDP> *qOut);
 		#endif
 
 	};
 
+	namespace Detail
+	{
+		//! What the Transformer methods are traced with, see configPARK_TRACE
+		#if(configPARK_TRACE == 1)
+			typedef RecordingTrace LibraryTrace;
+		#else
+			typedef NullTrace LibraryTrace;
+		#endif
+
+		//! Header-only kernels that the double methods forward to
+		typedef BasicTransformer<double, RadianAngle<double>, LibmTrig, LibraryTrace> DoubleTransformer;
+		typedef BasicTransformer<double, BamAngle<uint32_t>, LibmTrig, LibraryTrace> DoubleBamTransformer;
+	}
+
 	//===============================================================================================//
 	//====================================== INLINE FUNCTIONS =======================================//
 	//===============================================================================================//
-		
-	// none
+
+	// The double scalar methods are defined here. They are compiled once into Transformer.cpp,
+	// or, when config_PARK_TRANSFORM_HEADER_ONLY is 1, made inline in every translation unit
+	// that includes this header (removing the call overhead from tight control loops).
+	#if(config_PARK_TRANSFORM_HEADER_ONLY == 1) || defined(PARK_TRANSFORM_TRANSFORMER_CPP)
+
+	#if(config_PARK_TRANSFORM_HEADER_ONLY == 1)
+		#define PARK_TRANSFORM_INLINE inline
+	#else
+		#define PARK_TRANSFORM_INLINE
+	#endif
+
+	PARK_TRANSFORM_INLINE void Transformer::Forward(double alpha, double beta, double theta, double *d, double *q)
+	{
+		Detail::DoubleTransformer::Forward(alpha, beta, theta, d, q);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::Inverse(double d, double q, double theta, double *alpha, double *beta)
+	{
+		Detail::DoubleTransformer::Inverse(d, q, theta, alpha, beta);
+	}
+
+	PARK_TRANSFORM_INLINE Rotation<double> Transformer::CalcRotation(double theta)
+	{
+		return Detail::DoubleTransformer::CalcRotation(theta);
+	}
+
+	PARK_TRANSFORM_INLINE Rotation<double> Transformer::CalcRotation(Bam32 theta)
+	{
+		return Detail::DoubleBamTransformer::CalcRotation(theta);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::Forward(double alpha, double beta, Bam32 theta, double *d, double *q)
+	{
+		Detail::DoubleBamTransformer::Forward(alpha, beta, theta, d, q);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::Inverse(double d, double q, Bam32 theta, double *alpha, double *beta)
+	{
+		Detail::DoubleBamTransformer::Inverse(d, q, theta, alpha, beta);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::Forward(
+		double alpha,
+		double beta,
+		const Rotation<double> &rotation,
+		double *d,
+		double *q)
+	{
+		Detail::DoubleTransformer::Forward(alpha, beta, rotation, d, q);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::Inverse(
+		double d,
+		double q,
+		const Rotation<double> &rotation,
+		double *alpha,
+		double *beta)
+	{
+		Detail::DoubleTransformer::Inverse(d, q, rotation, alpha, beta);
+	}
+
+	PARK_TRANSFORM_INLINE Dq<double> Transformer::Forward(double alpha, double beta, double theta)
+	{
+		return Detail::DoubleTransformer::Forward(alpha, beta, theta);
+	}
+
+	PARK_TRANSFORM_INLINE Dq<double> Transformer::Forward(double alpha, double beta, const Rotation<double> &rotation)
+	{
+		return Detail::DoubleTransformer::Forward(alpha, beta, rotation);
+	}
+
+	PARK_TRANSFORM_INLINE AlphaBeta<double> Transformer::Inverse(double d, double q, double theta)
+	{
+		return Detail::DoubleTransformer::Inverse(d, q, theta);
+	}
+
+	PARK_TRANSFORM_INLINE AlphaBeta<double> Transformer::Inverse(double d, double q, const Rotation<double> &rotation)
+	{
+		return Detail::DoubleTransformer::Inverse(d, q, rotation);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::ForwardFromABC(double a, double b, double c, double theta,
+		double *d, double *q, double *zero)
+	{
+		Dq0<double> dq0 = Detail::DoubleTransformer::ForwardFromABC(a, b, c, theta);
+		*d = dq0.d;
+		*q = dq0.q;
+		*zero = dq0.zero;
+	}
+
+	PARK_TRANSFORM_INLINE Dq0<double> Transformer::ForwardFromABC(double a, double b, double c, double theta)
+	{
+		return Detail::DoubleTransformer::ForwardFromABC(a, b, c, theta);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::ForwardFromAB(double a, double b, double theta, double *d, double *q)
+	{
+		Dq<double> dq = Detail::DoubleTransformer::ForwardFromAB(a, b, theta);
+		*d = dq.d;
+		*q = dq.q;
+	}
+
+	PARK_TRANSFORM_INLINE Dq<double> Transformer::ForwardFromAB(double a, double b, double theta)
+	{
+		return Detail::DoubleTransformer::ForwardFromAB(a, b, theta);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::InverseSvpwm(double d, double q, double theta,
+		double *dutyA, double *dutyB, double *dutyC)
+	{
+		Abc<double> duties = Detail::DoubleTransformer::InverseSvpwm(d, q, theta);
+		*dutyA = duties.a;
+		*dutyB = duties.b;
+		*dutyC = duties.c;
+	}
+
+	PARK_TRANSFORM_INLINE Abc<double> Transformer::InverseSvpwm(double d, double q, double theta)
+	{
+		return Detail::DoubleTransformer::InverseSvpwm(d, q, theta);
+	}
+
+	PARK_TRANSFORM_INLINE void Transformer::Reframe(double d, double q, double thetaFrom, double thetaTo,
+		double *dOut, double *qOut)
+	{
+		Detail::DoubleTransformer::Reframe(d, q, thetaFrom, thetaTo, dOut, qOut);
+	}
+
+	PARK_TRANSFORM_INLINE Dq<double> Transformer::Reframe(double d, double q, double thetaFrom, double thetaTo)
+	{
+		return Detail::DoubleTransformer::Reframe(d, q, thetaFrom, thetaTo);
+	}
+
+	#undef PARK_TRANSFORM_INLINE
+
+	#endif // #if(config_PARK_TRANSFORM_HEADER_ONLY == 1) || defined(PARK_TRANSFORM_TRANSFORMER_CPP)
 
 	//===============================================================================================//
 	//====================================== PUBLIC VARIABLES =======================================//
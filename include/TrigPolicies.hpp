@@ -0,0 +1,134 @@
+//!
+//! @file 			TrigPolicies.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Trig policies for BasicTransformer, which define how sin/cos are evaluated.
+//! @details
+//!					Each policy provides:
+//!						template <typename T, class AnglePolicy>
+//!						static Rotation<T> CalcRotation(typename AnglePolicy::angle_type theta)
+//!					See README.rst
+
+//===============================================================================================//
+//====================================== HEADER GUARD ===========================================//
+//===============================================================================================//
+
+#ifndef PARK_TRANSFORM_TRIG_POLICIES_H
+#define PARK_TRANSFORM_TRIG_POLICIES_H
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <stdint.h>
+#include <type_traits>
+
+// User includes
+#include "Cordic.hpp"
+#include "Rotation.hpp"
+#include "Scalar.hpp"
+#include "SinCos.hpp"
+#include "SinCosLut.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! @brief		sin/cos from the C library, in the precision of the angle policy's radians
+	//!				(sincosf() for float angles, sincos() for double).
+	struct LibmTrig
+	{
+		template <typename T, class AnglePolicy>
+		static Rotation<T> CalcRotation(typename AnglePolicy::angle_type theta)
+		{
+			auto radians = AnglePolicy::ToRadians(theta);
+			decltype(radians) sinTheta, cosTheta;
+			SinCos(radians, &sinTheta, &cosTheta);
+			return Rotation<T>(ScalarTraits<T>::FromDouble(cosTheta), ScalarTraits<T>::FromDouble(sinTheta));
+		}
+	};
+
+	//! @brief		sin/cos from a compile-time SinCosLut, no floating point involved.
+	template <class Lut, LutInterpolation interpolation = LutInterpolation::NONE>
+	struct LutTrig
+	{
+		template <typename T, class AnglePolicy>
+		static Rotation<T> CalcRotation(typename AnglePolicy::angle_type theta)
+		{
+			int32_t sinTheta, cosTheta;
+			AnglePolicy::template LutSinCos<Lut, interpolation>(theta, &sinTheta, &cosTheta);
+			return Rotation<T>(ScalarTraits<T>::FromRaw(cosTheta, Lut::numFracBits),
+				ScalarTraits<T>::FromRaw(sinTheta, Lut::numFracBits));
+		}
+	};
+
+	//! @brief		sin/cos by CORDIC (see Cordic.hpp), shifts and adds only and no table of
+	//!				values. The angle is converted to a Bam32 first.
+	//! @details	For fixed-point types, BasicTransformer's Forward() and Inverse() of an angle
+	//!				call Rotate(), which turns (x, y) in the CORDIC loop instead of multiplying
+	//!				by sin/cos. CalcRotation() is still used for precomputed rotations, so the
+	//!				Rotation overloads are within a few LSB's of the angle ones, not bit-exact.
+	template <int numIterations>
+	struct CordicTrig
+	{
+		//! Floats have no raw value to shift, so they multiply by CalcRotation()'s sin/cos
+		template <typename T>
+		struct RotatesVector : std::integral_constant<bool, !std::is_floating_point<T>::value> {};
+
+		template <typename T, class AnglePolicy>
+		static Rotation<T> CalcRotation(typename AnglePolicy::angle_type theta)
+		{
+			typedef Cordic<numIterations> C;
+			int32_t sinTheta, cosTheta;
+			C::SinCos(AnglePolicy::ToBam32(theta), &sinTheta, &cosTheta);
+			return Rotation<T>(ScalarTraits<T>::FromRaw(cosTheta, C::numFracBits),
+				ScalarTraits<T>::FromRaw(sinTheta, C::numFracBits));
+		}
+
+		//! @brief		(x, y) rotated by -theta (Forward()) or theta (Inverse()), saturated.
+		template <typename T, class AnglePolicy>
+		static void Rotate(T x, T y, typename AnglePolicy::angle_type theta, bool inverse, T *xOut, T *yOut)
+		{
+			typedef ScalarTraits<T> S;
+			Bam32 angle = AnglePolicy::ToBam32(theta);
+			if(!inverse)
+				angle = Bam32(0u - angle.value);
+
+			int64_t xRaw, yRaw;
+			Cordic<numIterations>::Rotate(S::Raw(x), S::Raw(y), angle, &xRaw, &yRaw);
+			*xOut = S::FromRaw(SaturateRaw(xRaw), S::numFracBits);
+			*yOut = S::FromRaw(SaturateRaw(yRaw), S::numFracBits);
+		}
+
+	private:
+
+		static int32_t SaturateRaw(int64_t raw)
+		{
+			return (int32_t)(raw > INT32_MAX ? INT32_MAX : (raw < INT32_MIN ? INT32_MIN : raw));
+		}
+	};
+
+	//! @brief		True if TrigPolicy rotates vectors of T itself (with a Rotate() like CordicTrig's),
+	//!				rather than BasicTransformer multiplying by the sin/cos from CalcRotation().
+	template <class TrigPolicy, typename T, typename = void>
+	struct TrigRotatesVector : std::false_type {};
+
+	template <class TrigPolicy, typename T>
+	struct TrigRotatesVector<TrigPolicy, T,
+		typename std::enable_if<TrigPolicy::template RotatesVector<T>::value>::type> : std::true_type {};
+
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_TRIG_POLICIES_H
+
+// EOF
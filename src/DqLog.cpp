@@ -0,0 +1,336 @@
+//!
+//! @file 			DqLog.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Compressed d-q logs, delta coded into variable-length integers.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <string.h>
+
+// User includes
+#include "../include/Config.hpp"
+#include "../include/DqLog.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	static const uint8_t dqLogMagic[8] = { 'P', 'A', 'R', 'K', 'D', 'Q', 'L', 'G' };
+
+	static const uint16_t dqLogVersion = 1;
+
+	//! Bytes of the fixed size payload size field in each block
+	static const size_t payloadSizeSize = 4;
+
+	//! Zigzag of the wrapping difference of the bit patterns, so small steps either way are
+	//! small numbers
+	template <typename BitsT>
+	struct DqLogDeltaCoding
+	{
+		typedef BitsT Bits;
+		static constexpr Bits signBit = (Bits)1 << (sizeof(Bits)*8 - 1);
+		static constexpr uint64_t maxResidual = (Bits)~(Bits)0;
+
+		static uint64_t Residual(Bits bits, Bits prev)
+		{
+			Bits delta = bits - prev;
+			return (Bits)(delta << 1) ^ (Bits)(0 - (delta >> (sizeof(Bits)*8 - 1)));
+		}
+
+		static Bits Apply(uint64_t residual, Bits prev)
+		{
+			Bits zigzag = (Bits)residual;
+			return prev + ((zigzag >> 1) ^ (Bits)(0 - (zigzag & 1)));
+		}
+	};
+
+	//! Residual coding of each value type, on its bit pattern
+	template <typename T> struct DqLogCoding;
+
+	template <>
+	struct DqLogCoding<int32_t> : DqLogDeltaCoding<uint32_t>
+	{
+		static Bits ToBits(int32_t value) { return (uint32_t)value; }
+		static int32_t FromBits(Bits bits) { return (int32_t)bits; }
+	};
+
+	//! IEEE floats mapped to integers in the same order, so nearby values have nearby bits.
+	//! The mapping is one to one, so -0.0 and NaN payloads survive.
+	template <typename T, typename BitsT>
+	struct DqLogFloatCoding : DqLogDeltaCoding<BitsT>
+	{
+		typedef BitsT Bits;
+		static constexpr Bits signBit = DqLogDeltaCoding<BitsT>::signBit;
+
+		static Bits ToBits(T value)
+		{
+			Bits bits;
+			memcpy(&bits, &value, sizeof(bits));
+			return (bits & signBit) ? ~bits : (bits | signBit);
+		}
+
+		static T FromBits(Bits bits)
+		{
+			bits = (bits & signBit) ? (bits & ~signBit) : ~bits;
+			T value;
+			memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+	};
+
+	template <> struct DqLogCoding<float> : DqLogFloatCoding<float, uint32_t> {};
+	template <> struct DqLogCoding<double> : DqLogFloatCoding<double, uint64_t> {};
+
+	static uint8_t *PutVarint(uint8_t *out, uint64_t value)
+	{
+		while(value >= 0x80)
+		{
+			*out++ = (uint8_t)value | 0x80;
+			value >>= 7;
+		}
+		*out++ = (uint8_t)value;
+		return out;
+	}
+
+	//! Returns false if the varint runs past end or is longer than 64 bits
+	static inline bool GetVarint(const uint8_t *&pos, const uint8_t *end, uint64_t &value)
+	{
+		// Most residuals are one byte
+		if(pos < end && *pos < 0x80)
+		{
+			value = *pos++;
+			return true;
+		}
+
+		value = 0;
+		for(unsigned shift = 0; shift < 64; shift += 7)
+		{
+			if(pos == end)
+				return false;
+			uint8_t byte = *pos++;
+			// The 10th byte holds only bit 63
+			if(shift == 63 && byte > 1)
+				return false;
+			value |= (uint64_t)(byte & 0x7F) << shift;
+			if(byte < 0x80)
+				return true;
+		}
+		return false;
+	}
+
+	static void PutLittleEndian(uint8_t *out, uint64_t value, size_t numBytes)
+	{
+		for(size_t i = 0; i < numBytes; i++)
+			out[i] = (uint8_t)(value >> (8*i));
+	}
+
+	static uint64_t GetLittleEndian(const uint8_t *in, size_t numBytes)
+	{
+		uint64_t value = 0;
+		for(size_t i = 0; i < numBytes; i++)
+			value |= (uint64_t)in[i] << (8*i);
+		return value;
+	}
+
+	//===============================================================================================//
+	//========================================== ENCODER ============================================//
+	//===============================================================================================//
+
+	DqLogEncoder::DqLogEncoder(SampleType type, double sampleRate, uint8_t cdp)
+	{
+		_header.type = type;
+		_header.cdp = cdp;
+		_header.sampleRate = sampleRate;
+	}
+
+	size_t DqLogEncoder::EncodeHeader(uint8_t *out) const
+	{
+		// Byte by byte, so the log is the same on any host
+		uint64_t sampleRateBits;
+		memcpy(&sampleRateBits, &_header.sampleRate, sizeof(sampleRateBits));
+
+		memcpy(out, dqLogMagic, sizeof(dqLogMagic));
+		PutLittleEndian(&out[8], dqLogVersion, 2);
+		out[10] = (uint8_t)_header.type;
+		out[11] = _header.cdp;
+		PutLittleEndian(&out[12], 0, 4);
+		PutLittleEndian(&out[16], sampleRateBits, 8);
+		return headerSize;
+	}
+
+	template <typename T>
+	size_t DqLogEncoder::Encode(const T *d, const T *q, size_t numSamples, uint8_t *out) const
+	{
+		typedef DqLogCoding<T> Coding;
+
+		if(SampleTypeOf<T>::value != _header.type || numSamples == 0 || numSamples > configPARK_DQ_LOG_BLOCK_SIZE)
+			return 0;
+
+		uint8_t *payload = PutVarint(out, numSamples) + payloadSizeSize;
+		uint8_t *pos = payload;
+
+		// Each block starts from 0, so blocks decode on their own
+		const T *signals[2] = { d, q };
+		for(int k = 0; k < 2; k++)
+		{
+			typename Coding::Bits prev = 0;
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				typename Coding::Bits bits = Coding::ToBits(signals[k][i]);
+				pos = PutVarint(pos, Coding::Residual(bits, prev));
+				prev = bits;
+			}
+		}
+
+		PutLittleEndian(payload - payloadSizeSize, (uint64_t)(pos - payload), payloadSizeSize);
+		return pos - out;
+	}
+
+	size_t DqLogEncoder::EncodeBlock(const double *d, const double *q, size_t numSamples, uint8_t *out) const
+	{
+		return Encode(d, q, numSamples, out);
+	}
+
+	size_t DqLogEncoder::EncodeBlock(const float *d, const float *q, size_t numSamples, uint8_t *out) const
+	{
+		return Encode(d, q, numSamples, out);
+	}
+
+	size_t DqLogEncoder::EncodeBlock(const int32_t *d, const int32_t *q, size_t numSamples, uint8_t *out) const
+	{
+		return Encode(d, q, numSamples, out);
+	}
+
+	size_t DqLogEncoder::EncodeEnd(uint8_t *out) const
+	{
+		return PutVarint(out, 0) - out;
+	}
+
+	//===============================================================================================//
+	//========================================== DECODER ============================================//
+	//===============================================================================================//
+
+	DqLogDecoder::DqLogDecoder() :
+		_hasHeader(false)
+	{
+		memset(&_header, 0, sizeof(_header));
+	}
+
+	DqLogStatus DqLogDecoder::DecodeHeader(const uint8_t *in, size_t size, size_t *numUsed)
+	{
+		*numUsed = 0;
+		if(size < DqLogEncoder::headerSize)
+			return DqLogStatus::NEED_MORE;
+		if(memcmp(in, dqLogMagic, sizeof(dqLogMagic)) != 0 || GetLittleEndian(&in[8], 2) != dqLogVersion)
+			return DqLogStatus::ERROR;
+
+		DqLogHeader header;
+		header.type = (SampleType)in[10];
+		header.cdp = in[11];
+		uint64_t sampleRateBits = GetLittleEndian(&in[16], 8);
+		memcpy(&header.sampleRate, &sampleRateBits, sizeof(header.sampleRate));
+		if(SampleTypeSize(header.type) == 0 || (header.type != SampleType::INT32 && header.cdp != 0) || header.cdp > 31)
+			return DqLogStatus::ERROR;
+
+		_header = header;
+		_hasHeader = true;
+		*numUsed = DqLogEncoder::headerSize;
+		return DqLogStatus::OK;
+	}
+
+	template <typename T>
+	DqLogStatus DqLogDecoder::Decode(const uint8_t *in, size_t size, T *d, T *q,
+		size_t *numSamples, size_t *numUsed) const
+	{
+		typedef DqLogCoding<T> Coding;
+
+		*numSamples = 0;
+		*numUsed = 0;
+		if(!_hasHeader || SampleTypeOf<T>::value != _header.type)
+			return DqLogStatus::ERROR;
+
+		const uint8_t *pos = in;
+		const uint8_t *end = in + size;
+		uint64_t num;
+		if(!GetVarint(pos, end, num))
+			return (size < 10) ? DqLogStatus::NEED_MORE : DqLogStatus::ERROR;
+		if(num == 0)
+		{
+			*numUsed = pos - in;
+			return DqLogStatus::END;
+		}
+		if(num > configPARK_DQ_LOG_BLOCK_SIZE)
+			return DqLogStatus::ERROR;
+
+		if((size_t)(end - pos) < payloadSizeSize)
+			return DqLogStatus::NEED_MORE;
+		uint64_t payloadSize = GetLittleEndian(pos, payloadSizeSize);
+		pos += payloadSizeSize;
+		if(payloadSize > DqLogEncoder::MaxBlockSize((size_t)num))
+			return DqLogStatus::ERROR;
+		if((uint64_t)(end - pos) < payloadSize)
+			return DqLogStatus::NEED_MORE;
+
+		// From here the block's extent is known, so a damaged payload can be skipped
+		const uint8_t *payloadEnd = pos + payloadSize;
+		const size_t blockSize = payloadEnd - in;
+		T *signals[2] = { d, q };
+		for(int k = 0; k < 2; k++)
+		{
+			T *out = signals[k];
+			typename Coding::Bits bits = 0;
+			for(size_t i = 0; i < (size_t)num; i++)
+			{
+				uint64_t residual;
+				if(!GetVarint(pos, payloadEnd, residual) || residual > Coding::maxResidual)
+				{
+					*numUsed = blockSize;
+					return DqLogStatus::ERROR;
+				}
+				bits = Coding::Apply(residual, bits);
+				out[i] = Coding::FromBits(bits);
+			}
+		}
+		if(pos != payloadEnd)
+		{
+			*numUsed = blockSize;
+			return DqLogStatus::ERROR;
+		}
+
+		*numSamples = (size_t)num;
+		*numUsed = pos - in;
+		return DqLogStatus::OK;
+	}
+
+	DqLogStatus DqLogDecoder::DecodeBlock(const uint8_t *in, size_t size, double *d, double *q,
+		size_t *numSamples, size_t *numUsed) const
+	{
+		return Decode(in, size, d, q, numSamples, numUsed);
+	}
+
+	DqLogStatus DqLogDecoder::DecodeBlock(const uint8_t *in, size_t size, float *d, float *q,
+		size_t *numSamples, size_t *numUsed) const
+	{
+		return Decode(in, size, d, q, numSamples, numUsed);
+	}
+
+	DqLogStatus DqLogDecoder::DecodeBlock(const uint8_t *in, size_t size, int32_t *d, int32_t *q,
+		size_t *numSamples, size_t *numUsed) const
+	{
+		return Decode(in, size, d, q, numSamples, numUsed);
+	}
+
+} // namespace ParkTransform
+
+// EOF
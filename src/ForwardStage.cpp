@@ -0,0 +1,170 @@
+//!
+//! @file 			ForwardStage.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Streaming Forward() stage over an SPSC ring.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <chrono>
+
+// User includes
+#include "../include/Config.hpp"
+#include "../include/ForwardStage.hpp"
+#include "../include/Simd.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	static const int numLatencyBins = 40;
+
+	//! Single writer, so no read-modify-write needed
+	template <typename T>
+	static void Add(std::atomic<T> &counter, T value)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	template <typename T>
+	static void Max(std::atomic<T> &counter, T value)
+	{
+		if(value > counter.load(std::memory_order_relaxed))
+			counter.store(value, std::memory_order_relaxed);
+	}
+
+	uint64_t StageNowNs()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	uint64_t StageMetrics::LatencyPercentileNs(double fraction) const
+	{
+		uint64_t target = (uint64_t)(fraction*(double)numProcessed);
+		uint64_t count = 0;
+		for(int i = 0; i < numLatencyBins; i++)
+		{
+			count += latencyHistogram[i];
+			if(count >= target && count > 0)
+				return ((uint64_t)1 << (i + 1)) - 1;
+		}
+		return maxLatencyNs;
+	}
+
+	ForwardStage::ForwardStage() :
+		_numPushed(0),
+		_numRejected(0),
+		_numProcessed(0),
+		_numProcessCalls(0),
+		_sumLatencyNs(0),
+		_maxLatencyNs(0),
+		_sumOccupancy(0),
+		_maxOccupancy(0)
+	{
+		for(int i = 0; i < numLatencyBins; i++)
+			_latencyHistogram[i].store(0, std::memory_order_relaxed);
+	}
+
+	bool ForwardStage::Push(double alpha, double beta, double theta)
+	{
+		StageSample sample = { alpha, beta, theta, StageNowNs() };
+		if(!_ring.TryPush(sample))
+		{
+			Add<uint64_t>(_numRejected, 1);
+			return false;
+		}
+		Add<uint64_t>(_numPushed, 1);
+		return true;
+	}
+
+	size_t ForwardStage::Process(double *d, double *q, size_t maxSamples)
+	{
+		// The batch kernel wants separate arrays, so samples are split out a chunk at a time
+		const size_t chunkSize = 256;
+		double alpha[chunkSize], beta[chunkSize], theta[chunkSize];
+		uint64_t timestamps[chunkSize];
+
+		uint32_t occupancy = _ring.Size();
+		size_t numDone = 0;
+		Simd::Isa isa = Simd::GetBestIsa();
+
+		while(numDone < maxSamples)
+		{
+			const StageSample *samples;
+			size_t num = _ring.Peek(&samples);
+			if(num == 0)
+				break;
+			if(num > chunkSize)
+				num = chunkSize;
+			if(num > maxSamples - numDone)
+				num = maxSamples - numDone;
+
+			for(size_t i = 0; i < num; i++)
+			{
+				alpha[i] = samples[i].alpha;
+				beta[i] = samples[i].beta;
+				theta[i] = samples[i].theta;
+				timestamps[i] = samples[i].timestampNs;
+			}
+			_ring.Consume((uint32_t)num);
+
+			Simd::ForwardBatch(isa, alpha, beta, theta, &d[numDone], &q[numDone], num);
+
+			uint64_t now = StageNowNs();
+			uint64_t sumLatency = 0, maxLatency = 0;
+			for(size_t i = 0; i < num; i++)
+			{
+				uint64_t latency = now - timestamps[i];
+				sumLatency += latency;
+				maxLatency = (latency > maxLatency) ? latency : maxLatency;
+				int bin = (latency == 0) ? 0 : 63 - __builtin_clzll(latency);
+				Add<uint64_t>(_latencyHistogram[(bin < numLatencyBins) ? bin : numLatencyBins - 1], 1);
+			}
+			Add(_sumLatencyNs, sumLatency);
+			Max(_maxLatencyNs, maxLatency);
+			numDone += num;
+		}
+
+		if(numDone > 0)
+		{
+			// Occupancy is only meaningful when there was something to do
+			Add<uint64_t>(_numProcessCalls, 1);
+			Add<uint64_t>(_sumOccupancy, occupancy);
+			Max(_maxOccupancy, occupancy);
+			Add<uint64_t>(_numProcessed, numDone);
+		}
+		return numDone;
+	}
+
+	StageMetrics ForwardStage::GetMetrics() const
+	{
+		StageMetrics metrics;
+		metrics.numPushed = _numPushed.load(std::memory_order_relaxed);
+		metrics.numRejected = _numRejected.load(std::memory_order_relaxed);
+		metrics.numProcessed = _numProcessed.load(std::memory_order_relaxed);
+		metrics.numProcessCalls = _numProcessCalls.load(std::memory_order_relaxed);
+		metrics.meanLatencyNs = metrics.numProcessed ?
+			(double)_sumLatencyNs.load(std::memory_order_relaxed)/(double)metrics.numProcessed : 0.0;
+		metrics.maxLatencyNs = _maxLatencyNs.load(std::memory_order_relaxed);
+		for(int i = 0; i < numLatencyBins; i++)
+			metrics.latencyHistogram[i] = _latencyHistogram[i].load(std::memory_order_relaxed);
+		metrics.meanOccupancy = metrics.numProcessCalls ?
+			(double)_sumOccupancy.load(std::memory_order_relaxed)/(double)metrics.numProcessCalls : 0.0;
+		metrics.maxOccupancy = _maxOccupancy.load(std::memory_order_relaxed);
+		return metrics;
+	}
+
+} // namespace ParkTransform
+
+// EOF
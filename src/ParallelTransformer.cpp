@@ -0,0 +1,111 @@
+//!
+//! @file 			ParallelTransformer.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Multi-threaded batch Park transforms.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// User includes
+#include "../include/Config.hpp"
+#include "../include/ParallelTransformer.hpp"
+#include "../include/Simd.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! One batch call, shared by every thread running its chunks
+	template <typename T>
+	struct RotateJob
+	{
+		const T *x;
+		const T *y;
+		const T *theta;
+		T *outX;
+		T *outY;
+		size_t numSamples;
+		bool inverse;
+		Simd::Isa isa;
+
+		static void RunChunk(void *context, uint32_t chunkIndex)
+		{
+			const RotateJob &job = *(const RotateJob *)context;
+			size_t start = (size_t)chunkIndex*configPARK_PARALLEL_CHUNK_SIZE;
+			size_t num = (job.numSamples - start < configPARK_PARALLEL_CHUNK_SIZE) ?
+				job.numSamples - start : configPARK_PARALLEL_CHUNK_SIZE;
+
+			if(job.inverse)
+				Simd::InverseBatch(job.isa, job.x + start, job.y + start, job.theta + start,
+					job.outX + start, job.outY + start, num);
+			else
+				Simd::ForwardBatch(job.isa, job.x + start, job.y + start, job.theta + start,
+					job.outX + start, job.outY + start, num);
+		}
+	};
+
+	ParallelTransformer::ParallelTransformer(unsigned numThreads) :
+		_pool(numThreads)
+	{
+	}
+
+	template <typename T>
+	void ParallelTransformer::Rotate(const T *x, const T *y, const T *theta, T *outX, T *outY,
+		size_t numSamples, bool inverse)
+	{
+		RotateJob<T> job = { x, y, theta, outX, outY, numSamples, inverse, Simd::GetBestIsa() };
+		size_t numChunks = (numSamples + configPARK_PARALLEL_CHUNK_SIZE - 1)/configPARK_PARALLEL_CHUNK_SIZE;
+
+		// Chunk indexes are 32-bit, so very large inputs go through in several rounds
+		const size_t maxChunksPerRun = (size_t)1 << 31;
+		for(size_t firstChunk = 0; firstChunk < numChunks; firstChunk += maxChunksPerRun)
+		{
+			size_t offset = firstChunk*configPARK_PARALLEL_CHUNK_SIZE;
+			RotateJob<T> part = job;
+			part.x += offset;
+			part.y += offset;
+			part.theta += offset;
+			part.outX += offset;
+			part.outY += offset;
+			part.numSamples = numSamples - offset;
+			size_t num = (numChunks - firstChunk < maxChunksPerRun) ? numChunks - firstChunk : maxChunksPerRun;
+			_pool.Run(&RotateJob<T>::RunChunk, &part, (uint32_t)num);
+		}
+	}
+
+	void ParallelTransformer::ForwardBatch(const double *alpha, const double *beta, const double *theta,
+		double *d, double *q, size_t numSamples)
+	{
+		Rotate(alpha, beta, theta, d, q, numSamples, false);
+	}
+
+	void ParallelTransformer::ForwardBatch(const float *alpha, const float *beta, const float *theta,
+		float *d, float *q, size_t numSamples)
+	{
+		Rotate(alpha, beta, theta, d, q, numSamples, false);
+	}
+
+	void ParallelTransformer::InverseBatch(const double *d, const double *q, const double *theta,
+		double *alpha, double *beta, size_t numSamples)
+	{
+		Rotate(d, q, theta, alpha, beta, numSamples, true);
+	}
+
+	void ParallelTransformer::InverseBatch(const float *d, const float *q, const float *theta,
+		float *alpha, float *beta, size_t numSamples)
+	{
+		Rotate(d, q, theta, alpha, beta, numSamples, true);
+	}
+
+} // namespace ParkTransform
+
+// EOF
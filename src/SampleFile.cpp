@@ -0,0 +1,383 @@
+//!
+//! @file 			SampleFile.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Columnar binary sample files, memory-mapped for zero-copy batch transforms.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <math.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#define PARK_SAMPLE_FILE_MMAP 1
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#else
+	#define PARK_SAMPLE_FILE_MMAP 0
+#endif
+
+// User includes
+#include "../include/SampleFile.hpp"
+#include "../include/Simd.hpp"
+#include "../include/SinCosLut.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	static const char sampleFileMagic[8] = { 'P', 'A', 'R', 'K', 'S', 'M', 'P', 'L' };
+
+	//! Columns and the header are aligned to this many bytes
+	static const uint64_t sampleFileAlignment = 64;
+
+	//! Samples per chunk when INT32 files are converted through doubles
+	static const size_t fixedChunkSize = 1024;
+
+	//! The header is stored as-is, so only little-endian hosts can map it
+	static bool IsLittleEndian()
+	{
+		const uint16_t one = 1;
+		return *(const uint8_t *)&one == 1;
+	}
+
+	size_t SampleTypeSize(SampleType type)
+	{
+		switch(type)
+		{
+			case SampleType::FLOAT64:
+				return sizeof(double);
+			case SampleType::FLOAT32:
+				return sizeof(float);
+			case SampleType::INT32:
+				return sizeof(int32_t);
+		}
+		return 0;
+	}
+
+	unsigned SampleLayoutNumColumns(SampleLayout layout)
+	{
+		switch(layout)
+		{
+			case SampleLayout::ALPHA_BETA_THETA:
+				return 3;
+			case SampleLayout::DQ:
+				return 2;
+		}
+		return 0;
+	}
+
+	//! Total file size for the header, or 0 if it is invalid (or the size overflows)
+	static uint64_t ValidFileSize(const SampleFileHeader &header)
+	{
+		if(memcmp(header.magic, sampleFileMagic, sizeof(sampleFileMagic)) != 0 ||
+			header.version != sampleFileVersion ||
+			header.headerSize < sizeof(SampleFileHeader) || header.headerSize % sampleFileAlignment != 0 ||
+			header.columnStride % sampleFileAlignment != 0)
+			return 0;
+
+		uint64_t typeSize = SampleTypeSize(header.type);
+		unsigned numColumns = SampleLayoutNumColumns(header.layout);
+		if(typeSize == 0 || numColumns == 0 || header.numColumns != numColumns ||
+			(header.type != SampleType::INT32 && header.cdp != 0) || header.cdp > 31)
+			return 0;
+
+		// Only fixed-point angles need a unit, the float types are always radians
+		bool hasThetaUnit = header.type == SampleType::INT32 && header.layout == SampleLayout::ALPHA_BETA_THETA;
+		if(hasThetaUnit != (header.thetaPerTurn != 0))
+			return 0;
+
+		if(header.numSamples > UINT64_MAX/typeSize || header.columnStride < header.numSamples*typeSize ||
+			header.columnStride > (UINT64_MAX - header.headerSize)/numColumns)
+			return 0;
+		return header.headerSize + numColumns*header.columnStride;
+	}
+
+	//===============================================================================================//
+	//========================================== READER =============================================//
+	//===============================================================================================//
+
+	SampleFileReader::SampleFileReader() :
+		_data(NULL),
+		_size(0)
+	{
+		memset(&_header, 0, sizeof(_header));
+	}
+
+	SampleFileReader::~SampleFileReader()
+	{
+		Close();
+	}
+
+	bool SampleFileReader::Open(const char *path)
+	{
+		Close();
+
+		#if(PARK_SAMPLE_FILE_MMAP == 1)
+			if(!IsLittleEndian())
+				return false;
+
+			int fd = open(path, O_RDONLY);
+			if(fd < 0)
+				return false;
+
+			struct stat status;
+			if(fstat(fd, &status) != 0 || (uint64_t)status.st_size < sizeof(SampleFileHeader) ||
+				(uint64_t)status.st_size > SIZE_MAX)
+			{
+				close(fd);
+				return false;
+			}
+
+			size_t size = (size_t)status.st_size;
+			void *data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+			// The mapping stays valid after the file is closed
+			close(fd);
+			if(data == MAP_FAILED)
+				return false;
+
+			SampleFileHeader header;
+			memcpy(&header, data, sizeof(header));
+			uint64_t fileSize = ValidFileSize(header);
+			if(fileSize == 0 || fileSize > size)
+			{
+				munmap(data, size);
+				return false;
+			}
+
+			// Batch transforms read each column front to back
+			madvise(data, size, MADV_SEQUENTIAL);
+
+			_data = (const uint8_t *)data;
+			_size = size;
+			_header = header;
+			return true;
+		#else
+			(void)path;
+			return false;
+		#endif
+	}
+
+	void SampleFileReader::Close()
+	{
+		#if(PARK_SAMPLE_FILE_MMAP == 1)
+			if(_data)
+				munmap((void *)_data, _size);
+		#endif
+		_data = NULL;
+		_size = 0;
+		memset(&_header, 0, sizeof(_header));
+	}
+
+	//===============================================================================================//
+	//========================================== WRITER =============================================//
+	//===============================================================================================//
+
+	SampleFileWriter::SampleFileWriter() :
+		_data(NULL),
+		_size(0),
+		_fd(-1)
+	{
+		memset(&_header, 0, sizeof(_header));
+	}
+
+	SampleFileWriter::~SampleFileWriter()
+	{
+		Close();
+	}
+
+	bool SampleFileWriter::Create(const char *path, SampleLayout layout, SampleType type, size_t numSamples,
+		double sampleRate, uint8_t cdp, uint32_t thetaPerTurn)
+	{
+		Close();
+
+		SampleFileHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, sampleFileMagic, sizeof(sampleFileMagic));
+		header.version = sampleFileVersion;
+		header.headerSize = sizeof(SampleFileHeader);
+		header.layout = layout;
+		header.type = type;
+		header.cdp = cdp;
+		header.numColumns = (uint8_t)SampleLayoutNumColumns(layout);
+		header.numSamples = numSamples;
+		header.sampleRate = sampleRate;
+		if(type == SampleType::INT32 && layout == SampleLayout::ALPHA_BETA_THETA)
+			header.thetaPerTurn = thetaPerTurn;
+		uint64_t typeSize = SampleTypeSize(type);
+		if(typeSize == 0 || numSamples > (UINT64_MAX - sampleFileAlignment)/typeSize)
+			return false;
+		header.columnStride = (numSamples*typeSize + sampleFileAlignment - 1)/sampleFileAlignment*sampleFileAlignment;
+
+		uint64_t fileSize = ValidFileSize(header);
+		if(fileSize == 0 || fileSize > SIZE_MAX)
+			return false;
+
+		#if(PARK_SAMPLE_FILE_MMAP == 1)
+			if(!IsLittleEndian())
+				return false;
+
+			int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+			if(fd < 0)
+				return false;
+
+			// Reserving the blocks up front means a full disk fails here, rather than as a
+			// SIGBUS when a page of a sparse file is first written. macOS has no posix_fallocate().
+			#if defined(__APPLE__)
+				bool reserved = ftruncate(fd, (off_t)fileSize) == 0;
+			#else
+				bool reserved = posix_fallocate(fd, 0, (off_t)fileSize) == 0;
+			#endif
+			void *data = MAP_FAILED;
+			if(reserved)
+				data = mmap(NULL, (size_t)fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if(data == MAP_FAILED)
+			{
+				close(fd);
+				unlink(path);
+				return false;
+			}
+
+			memcpy(data, &header, sizeof(header));
+			_data = (uint8_t *)data;
+			_size = (size_t)fileSize;
+			_fd = fd;
+			_header = header;
+			return true;
+		#else
+			(void)path;
+			return false;
+		#endif
+	}
+
+	bool SampleFileWriter::Close()
+	{
+		bool ok = true;
+		#if(PARK_SAMPLE_FILE_MMAP == 1)
+			// munmap() doesn't report write-back errors, msync() does
+			if(_data)
+			{
+				ok = (msync(_data, _size, MS_SYNC) == 0);
+				ok = (munmap(_data, _size) == 0) && ok;
+			}
+			if(_fd >= 0)
+				ok = (close(_fd) == 0) && ok;
+		#endif
+		_data = NULL;
+		_size = 0;
+		_fd = -1;
+		memset(&_header, 0, sizeof(_header));
+		return ok;
+	}
+
+	//===============================================================================================//
+	//======================================== TRANSFORMS ===========================================//
+	//===============================================================================================//
+
+	//! Rounds and saturates, like ScalarTraits<QFixed> but with the fraction bits at runtime
+	static int32_t ToFixed(double value, double scale)
+	{
+		double scaled = value*scale;
+		if(scaled >= (double)INT32_MAX)
+			return INT32_MAX;
+		if(scaled <= (double)INT32_MIN)
+			return INT32_MIN;
+		return (int32_t)lrint(scaled);
+	}
+
+	static void ForwardFixed(const int32_t *alpha, const int32_t *beta, const int32_t *theta,
+		int32_t *d, int32_t *q, size_t numSamples, uint8_t cdp, uint32_t thetaPerTurn)
+	{
+		const double scale = (double)((int64_t)1 << cdp);
+		const double invScale = 1.0/scale;
+		const double thetaToRadians = invScale*2.0*LutMaths::pi/(double)thetaPerTurn;
+		Simd::Isa isa = Simd::GetBestIsa();
+
+		double alphaChunk[fixedChunkSize], betaChunk[fixedChunkSize], thetaChunk[fixedChunkSize];
+		for(size_t start = 0; start < numSamples; start += fixedChunkSize)
+		{
+			size_t num = (numSamples - start < fixedChunkSize) ? numSamples - start : fixedChunkSize;
+			for(size_t i = 0; i < num; i++)
+			{
+				alphaChunk[i] = (double)alpha[start + i]*invScale;
+				betaChunk[i] = (double)beta[start + i]*invScale;
+				thetaChunk[i] = (double)theta[start + i]*thetaToRadians;
+			}
+
+			// In place, alpha may alias d and beta may alias q
+			Simd::ForwardBatch(isa, alphaChunk, betaChunk, thetaChunk, alphaChunk, betaChunk, num);
+
+			for(size_t i = 0; i < num; i++)
+			{
+				d[start + i] = ToFixed(alphaChunk[i], scale);
+				q[start + i] = ToFixed(betaChunk[i], scale);
+			}
+		}
+	}
+
+	//! True if both paths exist and are the same file (including through links)
+	static bool IsSameFile(const char *path1, const char *path2)
+	{
+		#if(PARK_SAMPLE_FILE_MMAP == 1)
+			struct stat status1, status2;
+			return stat(path1, &status1) == 0 && stat(path2, &status2) == 0 &&
+				status1.st_dev == status2.st_dev && status1.st_ino == status2.st_ino;
+		#else
+			(void)path1;
+			(void)path2;
+			return false;
+		#endif
+	}
+
+	bool ForwardFile(const char *inPath, const char *outPath)
+	{
+		// Creating the output would truncate the mapped input under the reader
+		if(IsSameFile(inPath, outPath))
+			return false;
+
+		SampleFileReader reader;
+		if(!reader.Open(inPath) || reader.GetHeader().layout != SampleLayout::ALPHA_BETA_THETA)
+			return false;
+
+		const SampleFileHeader &header = reader.GetHeader();
+		SampleFileWriter writer;
+		if(!writer.Create(outPath, SampleLayout::DQ, header.type, reader.GetNumSamples(),
+			header.sampleRate, header.cdp))
+			return false;
+
+		size_t numSamples = reader.GetNumSamples();
+		switch(header.type)
+		{
+			case SampleType::FLOAT64:
+				Simd::ForwardBatch(Simd::GetBestIsa(), reader.GetColumn<double>(SampleColumn::ALPHA), reader.GetColumn<double>(SampleColumn::BETA),
+					reader.GetColumn<double>(SampleColumn::THETA), writer.GetColumn<double>(SampleColumn::D), writer.GetColumn<double>(SampleColumn::Q), numSamples);
+				break;
+			case SampleType::FLOAT32:
+				Simd::ForwardBatch(Simd::GetBestIsa(), reader.GetColumn<float>(SampleColumn::ALPHA), reader.GetColumn<float>(SampleColumn::BETA),
+					reader.GetColumn<float>(SampleColumn::THETA), writer.GetColumn<float>(SampleColumn::D), writer.GetColumn<float>(SampleColumn::Q), numSamples);
+				break;
+			case SampleType::INT32:
+				ForwardFixed(reader.GetColumn<int32_t>(SampleColumn::ALPHA), reader.GetColumn<int32_t>(SampleColumn::BETA),
+					reader.GetColumn<int32_t>(SampleColumn::THETA), writer.GetColumn<int32_t>(SampleColumn::D), writer.GetColumn<int32_t>(SampleColumn::Q),
+					numSamples, header.cdp, header.thetaPerTurn);
+				break;
+		}
+
+		return writer.Close();
+	}
+
+} // namespace ParkTransform
+
+// EOF
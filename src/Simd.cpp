@@ -0,0 +1,227 @@
+//!
+//! @file 			Simd.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Runtime CPU dispatch for the batch Park transform kernels.
+//! @details
+//!					See README.rst
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System headers
+#include <atomic>
+
+// User headers
+#include "../include/Simd.hpp"
+#include "SimdKernels.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+	namespace Simd
+	{
+
+		//===============================================================================================//
+		//===================================== PRIVATE FUNCTIONS =======================================//
+		//===============================================================================================//
+
+		//! Set by SetMaxIsa(), AVX512 (the widest) means no cap
+		static std::atomic<int> maxIsa((int)Isa::AVX512);
+
+		static bool CpuSupports(Isa isa)
+		{
+			#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+				switch(isa)
+				{
+					case Isa::AVX2:
+						return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+					case Isa::AVX512:
+						return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("fma");
+					default:
+						return true;
+				}
+			#else
+				return isa == Isa::SCALAR;
+			#endif
+		}
+
+		//! @brief		Returns the kernel table for isa, or NULL for SCALAR or if isa is unsupported.
+		static const Kernels *GetKernels(Isa isa)
+		{
+			const Kernels *kernels = NULL;
+			if(isa == Isa::AVX2)
+				kernels = GetAvx2Kernels();
+			else if(isa == Isa::AVX512)
+				kernels = GetAvx512Kernels();
+
+			if(kernels == NULL || !CpuSupports(isa))
+				return NULL;
+			return kernels;
+		}
+
+		//===============================================================================================//
+		//===================================== FUNCTION DEFINITIONS ====================================//
+		//===============================================================================================//
+
+		bool IsSupported(Isa isa)
+		{
+			return isa == Isa::SCALAR || GetKernels(isa) != NULL;
+		}
+
+		Isa GetBestIsa()
+		{
+			// Function-local static, so the CPUID checks run once (thread-safe since C++11)
+			static const Isa bestIsa =
+				IsSupported(Isa::AVX512) ? Isa::AVX512 :
+				IsSupported(Isa::AVX2) ? Isa::AVX2 :
+				Isa::SCALAR;
+			// The instruction sets are in order of width, and every narrower one is supported too
+			int cap = maxIsa.load(std::memory_order_relaxed);
+			return ((int)bestIsa < cap) ? bestIsa : (Isa)cap;
+		}
+
+		void SetMaxIsa(Isa isa)
+		{
+			maxIsa.store((int)isa, std::memory_order_relaxed);
+		}
+
+		const char *GetIsaName(Isa isa)
+		{
+			switch(isa)
+			{
+				case Isa::AVX2:
+					return "AVX2";
+				case Isa::AVX512:
+					return "AVX512";
+				default:
+					return "SCALAR";
+			}
+		}
+
+		void ForwardBatch(Isa isa, const double *alpha, const double *beta, const double *theta,
+			double *d, double *q, size_t numSamples)
+		{
+			ForwardBatch(isa, PolyAccuracy::FULL, alpha, beta, theta, d, q, numSamples);
+		}
+
+		void ForwardBatch(Isa isa, PolyAccuracy accuracy, const double *alpha, const double *beta, const double *theta,
+			double *d, double *q, size_t numSamples)
+		{
+			const Kernels *kernels = GetKernels(isa);
+			if(kernels)
+				kernels->rotateDouble[(int)accuracy](alpha, beta, theta, d, q, numSamples, false);
+			else if(accuracy == PolyAccuracy::LOW)
+				ScalarRotate<double, PolyAccuracy::LOW>(alpha, beta, theta, d, q, numSamples, false);
+			else if(accuracy == PolyAccuracy::MEDIUM)
+				ScalarRotate<double, PolyAccuracy::MEDIUM>(alpha, beta, theta, d, q, numSamples, false);
+			else
+				ScalarRotate<double, PolyAccuracy::FULL>(alpha, beta, theta, d, q, numSamples, false);
+		}
+
+		void ForwardBatch(Isa isa, const float *alpha, const float *beta, const float *theta,
+			float *d, float *q, size_t numSamples)
+		{
+			ForwardBatch(isa, PolyAccuracy::FULL, alpha, beta, theta, d, q, numSamples);
+		}
+
+		void ForwardBatch(Isa isa, PolyAccuracy accuracy, const float *alpha, const float *beta, const float *theta,
+			float *d, float *q, size_t numSamples)
+		{
+			const Kernels *kernels = GetKernels(isa);
+			if(kernels)
+				kernels->rotateFloat[(int)accuracy](alpha, beta, theta, d, q, numSamples, false);
+			else if(accuracy == PolyAccuracy::LOW)
+				ScalarRotate<float, PolyAccuracy::LOW>(alpha, beta, theta, d, q, numSamples, false);
+			else if(accuracy == PolyAccuracy::MEDIUM)
+				ScalarRotate<float, PolyAccuracy::MEDIUM>(alpha, beta, theta, d, q, numSamples, false);
+			else
+				ScalarRotate<float, PolyAccuracy::FULL>(alpha, beta, theta, d, q, numSamples, false);
+		}
+
+		void InverseBatch(Isa isa, const double *d, const double *q, const double *theta,
+			double *alpha, double *beta, size_t numSamples)
+		{
+			InverseBatch(isa, PolyAccuracy::FULL, d, q, theta, alpha, beta, numSamples);
+		}
+
+		void InverseBatch(Isa isa, PolyAccuracy accuracy, const double *d, const double *q, const double *theta,
+			double *alpha, double *beta, size_t numSamples)
+		{
+			const Kernels *kernels = GetKernels(isa);
+			if(kernels)
+				kernels->rotateDouble[(int)accuracy](d, q, theta, alpha, beta, numSamples, true);
+			else if(accuracy == PolyAccuracy::LOW)
+				ScalarRotate<double, PolyAccuracy::LOW>(d, q, theta, alpha, beta, numSamples, true);
+			else if(accuracy == PolyAccuracy::MEDIUM)
+				ScalarRotate<double, PolyAccuracy::MEDIUM>(d, q, theta, alpha, beta, numSamples, true);
+			else
+				ScalarRotate<double, PolyAccuracy::FULL>(d, q, theta, alpha, beta, numSamples, true);
+		}
+
+		void InverseBatch(Isa isa, const float *d, const float *q, const float *theta,
+			float *alpha, float *beta, size_t numSamples)
+		{
+			InverseBatch(isa, PolyAccuracy::FULL, d, q, theta, alpha, beta, numSamples);
+		}
+
+		void InverseBatch(Isa isa, PolyAccuracy accuracy, const float *d, const float *q, const float *theta,
+			float *alpha, float *beta, size_t numSamples)
+		{
+			const Kernels *kernels = GetKernels(isa);
+			if(kernels)
+				kernels->rotateFloat[(int)accuracy](d, q, theta, alpha, beta, numSamples, true);
+			else if(accuracy == PolyAccuracy::LOW)
+				ScalarRotate<float, PolyAccuracy::LOW>(d, q, theta, alpha, beta, numSamples, true);
+			else if(accuracy == PolyAccuracy::MEDIUM)
+				ScalarRotate<float, PolyAccuracy::MEDIUM>(d, q, theta, alpha, beta, numSamples, true);
+			else
+				ScalarRotate<float, PolyAccuracy::FULL>(d, q, theta, alpha, beta, numSamples, true);
+		}
+
+		void ForwardFromABCBatch(Isa isa, const double *a, const double *b, const double *c,
+			const double *theta, double *d, double *q, double *zero, size_t numSamples)
+		{
+			const Kernels *kernels = GetKernels(isa);
+			if(kernels)
+				kernels->forwardFromAbcDouble(a, b, c, theta, d, q, zero, numSamples);
+			else
+				ScalarForwardFromAbc(a, b, c, theta, d, q, zero, numSamples);
+		}
+
+		void ForwardFromABCBatch(Isa isa, const float *a, const float *b, const float *c,
+			const float *theta, float *d, float *q, float *zero, size_t numSamples)
+		{
+			const Kernels *kernels = GetKernels(isa);
+			if(kernels)
+				kernels->forwardFromAbcFloat(a, b, c, theta, d, q, zero, numSamples);
+			else
+				ScalarForwardFromAbc(a, b, c, theta, d, q, zero, numSamples);
+		}
+
+		void ForwardFromABBatch(Isa isa, const double *a, const double *b, const double *theta,
+			double *d, double *q, size_t numSamples)
+		{
+			ForwardFromABCBatch(isa, a, b, (const double *)NULL, theta, d, q, (double *)NULL, numSamples);
+		}
+
+		void ForwardFromABBatch(Isa isa, const float *a, const float *b, const float *theta,
+			float *d, float *q, size_t numSamples)
+		{
+			ForwardFromABCBatch(isa, a, b, (const float *)NULL, theta, d, q, (float *)NULL, numSamples);
+		}
+
+	} // namespace Simd
+} // namespace ParkTransform
+
+// EOF
@@ -0,0 +1,115 @@
+//!
+//! @file 			SimdAvx2.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			AVX2 + FMA batch Park transform kernels.
+//! @details
+//!					Compiled with -mavx2 -mfma (see Makefile). Only called after Simd.cpp has
+//!					checked that the CPU supports AVX2 and FMA.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+#include "SimdKernels.hpp"
+
+#if defined(__AVX2__) && defined(__FMA__)
+	#include <immintrin.h>
+#endif
+
+namespace ParkTransform
+{
+	namespace Simd
+	{
+
+	#if defined(__AVX2__) && defined(__FMA__)
+
+		namespace
+		{
+
+			//! @brief		4 x double vector traits for VecRotate().
+			struct Avx2Double
+			{
+				typedef double T;
+				typedef __m256d V;
+				typedef __m256d M;
+				static const size_t width = 4;
+
+				static V Load(const T *p) { return _mm256_loadu_pd(p); }
+				static void Store(T *p, V a) { _mm256_storeu_pd(p, a); }
+				static V Set1(T a) { return _mm256_set1_pd(a); }
+				static V Add(V a, V b) { return _mm256_add_pd(a, b); }
+				static V Sub(V a, V b) { return _mm256_sub_pd(a, b); }
+				static V Mul(V a, V b) { return _mm256_mul_pd(a, b); }
+				static V Fmadd(V a, V b, V c) { return _mm256_fmadd_pd(a, b, c); }
+				static V Fnmadd(V a, V b, V c) { return _mm256_fnmadd_pd(a, b, c); }
+				static V Round(V a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+				static V Floor(V a) { return _mm256_floor_pd(a); }
+				static V Abs(V a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+				static M CmpEq(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+				static M CmpLe(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+				static M MaskOr(M a, M b) { return _mm256_or_pd(a, b); }
+				static bool AllTrue(M a) { return _mm256_movemask_pd(a) == 0xF; }
+				static V Select(M m, V a, V b) { return _mm256_blendv_pd(b, a, m); }
+				static V NegateIf(M m, V a) { return _mm256_xor_pd(a, _mm256_and_pd(m, _mm256_set1_pd(-0.0))); }
+			};
+
+			//! @brief		8 x float vector traits for VecRotate().
+			struct Avx2Float
+			{
+				typedef float T;
+				typedef __m256 V;
+				typedef __m256 M;
+				static const size_t width = 8;
+
+				static V Load(const T *p) { return _mm256_loadu_ps(p); }
+				static void Store(T *p, V a) { _mm256_storeu_ps(p, a); }
+				static V Set1(T a) { return _mm256_set1_ps(a); }
+				static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+				static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+				static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+				static V Fmadd(V a, V b, V c) { return _mm256_fmadd_ps(a, b, c); }
+				static V Fnmadd(V a, V b, V c) { return _mm256_fnmadd_ps(a, b, c); }
+				static V Round(V a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+				static V Floor(V a) { return _mm256_floor_ps(a); }
+				static V Abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+				static M CmpEq(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+				static M CmpLe(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+				static M MaskOr(M a, M b) { return _mm256_or_ps(a, b); }
+				static bool AllTrue(M a) { return _mm256_movemask_ps(a) == 0xFF; }
+				static V Select(M m, V a, V b) { return _mm256_blendv_ps(b, a, m); }
+				static V NegateIf(M m, V a) { return _mm256_xor_ps(a, _mm256_and_ps(m, _mm256_set1_ps(-0.0f))); }
+			};
+
+			const Kernels _avx2Kernels = {
+				{ &VecRotate<Avx2Double, PolyAccuracy::LOW>, &VecRotate<Avx2Double, PolyAccuracy::MEDIUM>,
+					&VecRotate<Avx2Double, PolyAccuracy::FULL> },
+				{ &VecRotate<Avx2Float, PolyAccuracy::LOW>, &VecRotate<Avx2Float, PolyAccuracy::MEDIUM>,
+					&VecRotate<Avx2Float, PolyAccuracy::FULL> },
+				&VecForwardFromAbc<Avx2Double>,
+				&VecForwardFromAbc<Avx2Float>
+			};
+
+		} // namespace
+
+		const Kernels *GetAvx2Kernels()
+		{
+			return &_avx2Kernels;
+		}
+
+	#else
+
+		const Kernels *GetAvx2Kernels()
+		{
+			// Not built for AVX2 (non-x86 target)
+			return NULL;
+		}
+
+	#endif
+
+	} // namespace Simd
+} // namespace ParkTransform
+
+// EOF
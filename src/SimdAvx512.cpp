@@ -0,0 +1,123 @@
+//!
+//! @file 			SimdAvx512.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			AVX-512F batch Park transform kernels.
+//! @details
+//!					Compiled with -mavx512f -mfma (see Makefile). Only called after Simd.cpp has
+//!					checked that the CPU supports AVX-512F.
+
+#ifndef __cplusplus
+	#error Please build with C++ compiler
+#endif
+
+#include "SimdKernels.hpp"
+
+#if defined(__AVX512F__)
+	#include <immintrin.h>
+#endif
+
+namespace ParkTransform
+{
+	namespace Simd
+	{
+
+	#if defined(__AVX512F__)
+
+		namespace
+		{
+
+			//! @brief		8 x double vector traits for VecRotate().
+			struct Avx512Double
+			{
+				typedef double T;
+				typedef __m512d V;
+				typedef __mmask8 M;
+				static const size_t width = 8;
+
+				static V Load(const T *p) { return _mm512_loadu_pd(p); }
+				static void Store(T *p, V a) { _mm512_storeu_pd(p, a); }
+				static V Set1(T a) { return _mm512_set1_pd(a); }
+				static V Add(V a, V b) { return _mm512_add_pd(a, b); }
+				static V Sub(V a, V b) { return _mm512_sub_pd(a, b); }
+				static V Mul(V a, V b) { return _mm512_mul_pd(a, b); }
+				static V Fmadd(V a, V b, V c) { return _mm512_fmadd_pd(a, b, c); }
+				static V Fnmadd(V a, V b, V c) { return _mm512_fnmadd_pd(a, b, c); }
+				static V Round(V a) { return _mm512_maskz_roundscale_pd(0xFF, a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+				static V Floor(V a) { return _mm512_maskz_roundscale_pd(0xFF, a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+				static V Abs(V a) { return _mm512_abs_pd(a); }
+				static M CmpEq(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+				static M CmpLe(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+				static M MaskOr(M a, M b) { return a | b; }
+				static bool AllTrue(M a) { return a == 0xFF; }
+				static V Select(M m, V a, V b) { return _mm512_mask_blend_pd(m, b, a); }
+				static V NegateIf(M m, V a)
+				{
+					__m512i bits = _mm512_castpd_si512(a);
+					return _mm512_castsi512_pd(_mm512_mask_xor_epi64(bits, m, bits, _mm512_set1_epi64((long long)0x8000000000000000ULL)));
+				}
+			};
+
+			//! @brief		16 x float vector traits for VecRotate().
+			struct Avx512Float
+			{
+				typedef float T;
+				typedef __m512 V;
+				typedef __mmask16 M;
+				static const size_t width = 16;
+
+				static V Load(const T *p) { return _mm512_loadu_ps(p); }
+				static void Store(T *p, V a) { _mm512_storeu_ps(p, a); }
+				static V Set1(T a) { return _mm512_set1_ps(a); }
+				static V Add(V a, V b) { return _mm512_add_ps(a, b); }
+				static V Sub(V a, V b) { return _mm512_sub_ps(a, b); }
+				static V Mul(V a, V b) { return _mm512_mul_ps(a, b); }
+				static V Fmadd(V a, V b, V c) { return _mm512_fmadd_ps(a, b, c); }
+				static V Fnmadd(V a, V b, V c) { return _mm512_fnmadd_ps(a, b, c); }
+				static V Round(V a) { return _mm512_maskz_roundscale_ps(0xFFFF, a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+				static V Floor(V a) { return _mm512_maskz_roundscale_ps(0xFFFF, a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+				static V Abs(V a) { return _mm512_abs_ps(a); }
+				static M CmpEq(V a, V b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+				static M CmpLe(V a, V b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+				static M MaskOr(M a, M b) { return a | b; }
+				static bool AllTrue(M a) { return a == 0xFFFF; }
+				static V Select(M m, V a, V b) { return _mm512_mask_blend_ps(m, b, a); }
+				static V NegateIf(M m, V a)
+				{
+					__m512i bits = _mm512_castps_si512(a);
+					return _mm512_castsi512_ps(_mm512_mask_xor_epi32(bits, m, bits, _mm512_set1_epi32((int)0x80000000U)));
+				}
+			};
+
+			const Kernels _avx512Kernels = {
+				{ &VecRotate<Avx512Double, PolyAccuracy::LOW>, &VecRotate<Avx512Double, PolyAccuracy::MEDIUM>,
+					&VecRotate<Avx512Double, PolyAccuracy::FULL> },
+				{ &VecRotate<Avx512Float, PolyAccuracy::LOW>, &VecRotate<Avx512Float, PolyAccuracy::MEDIUM>,
+					&VecRotate<Avx512Float, PolyAccuracy::FULL> },
+				&VecForwardFromAbc<Avx512Double>,
+				&VecForwardFromAbc<Avx512Float>
+			};
+
+		} // namespace
+
+		const Kernels *GetAvx512Kernels()
+		{
+			return &_avx512Kernels;
+		}
+
+	#else
+
+		const Kernels *GetAvx512Kernels()
+		{
+			// Not built for AVX-512 (non-x86 target)
+			return NULL;
+		}
+
+	#endif
+
+	} // namespace Simd
+} // namespace ParkTransform
+
+// EOF
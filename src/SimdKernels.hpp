@@ -0,0 +1,306 @@
+//!
+//! @file 			SimdKernels.hpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Private, instruction-set independent SIMD kernel templates.
+//! @details
+//!					Included by each SimdXxx.cpp, which supplies a vector traits class and is
+//!					compiled with the matching -m flags. Everything that generates code lives in
+//!					an anonymous namespace, so AVX code can never be merged (by the linker) into
+//!					functions called on CPUs without AVX.
+
+#ifndef PARK_TRANSFORM_SIMD_KERNELS_H
+#define PARK_TRANSFORM_SIMD_KERNELS_H
+
+#include <stddef.h>
+
+#include "../include/PolySinCos.hpp"
+#include "../include/SinCos.hpp"
+
+namespace ParkTransform
+{
+	namespace Simd
+	{
+
+		//! @brief		Function table exported by each instruction set's translation unit.
+		//! @details	outX/outY = (x*cos + y*sin, y*cos - x*sin), with sin negated when inverse is
+		//!				true. This is Forward() when inverse is false and Inverse() when true.
+		struct Kernels
+		{
+			//! Indexed by PolyAccuracy
+			void (*rotateDouble[numPolyAccuracies])(const double *x, const double *y, const double *theta,
+				double *outX, double *outY, size_t numSamples, bool inverse);
+			void (*rotateFloat[numPolyAccuracies])(const float *x, const float *y, const float *theta,
+				float *outX, float *outY, size_t numSamples, bool inverse);
+			//! Clarke + forward Park. c == NULL means two sensors (c = -a - b), zero may be NULL.
+			void (*forwardFromAbcDouble)(const double *a, const double *b, const double *c,
+				const double *theta, double *d, double *q, double *zero, size_t numSamples);
+			void (*forwardFromAbcFloat)(const float *a, const float *b, const float *c,
+				const float *theta, float *d, float *q, float *zero, size_t numSamples);
+		};
+
+		//! @brief		Return NULL when the library was built without the instruction set.
+		const Kernels *GetAvx2Kernels();
+		const Kernels *GetAvx512Kernels();
+
+		namespace
+		{
+
+			//! @brief		Vector sin/cos of every lane of theta, to the given accuracy tier.
+			//! @details	VT is a traits class providing the vector type V, mask type M and the
+			//!				element-wise operations used below. Same reduction and polynomials as
+			//!				the scalar PolySinCos() (see PolySinCos.hpp).
+			template <class VT, PolyAccuracy accuracy>
+			inline void VecSinCos(typename VT::V theta, typename VT::V *sinTheta, typename VT::V *cosTheta)
+			{
+				typedef typename VT::V V;
+				typedef typename VT::M M;
+				typedef PolyReduction<typename VT::T> R;
+				typedef PolyCoeffs<typename VT::T, accuracy> C;
+
+				// n = nearest integer to theta/(pi/2), r = theta - n*pi/2
+				V n = VT::Round(VT::Mul(theta, VT::Set1(R::twoOverPi)));
+				V r = VT::Fnmadd(n, VT::Set1(R::pio2_1), theta);
+				r = VT::Fnmadd(n, VT::Set1(R::pio2_2), r);
+				r = VT::Fnmadd(n, VT::Set1(R::pio2_3), r);
+
+				V z = VT::Mul(r, r);
+				V sinPoly = VT::Set1(C::sinCoeffs[0]);
+				for(int i = 1; i < C::numSin; i++)
+					sinPoly = VT::Fmadd(sinPoly, z, VT::Set1(C::sinCoeffs[i]));
+				V cosPoly = VT::Set1(C::cosCoeffs[0]);
+				for(int i = 1; i < C::numCos; i++)
+					cosPoly = VT::Fmadd(cosPoly, z, VT::Set1(C::cosCoeffs[i]));
+				V sinR = VT::Mul(r, sinPoly);
+				V cosR = cosPoly;
+
+				// Quadrant = n mod 4, in 0..3
+				V quadrant = VT::Sub(n, VT::Mul(VT::Set1(4.0), VT::Floor(VT::Mul(n, VT::Set1(0.25)))));
+				M isQ1 = VT::CmpEq(quadrant, VT::Set1(1.0));
+				M isQ2 = VT::CmpEq(quadrant, VT::Set1(2.0));
+				M isQ3 = VT::CmpEq(quadrant, VT::Set1(3.0));
+				M swap = VT::MaskOr(isQ1, isQ3);
+
+				*sinTheta = VT::NegateIf(VT::MaskOr(isQ2, isQ3), VT::Select(swap, cosR, sinR));
+				*cosTheta = VT::NegateIf(VT::MaskOr(isQ1, isQ2), VT::Select(swap, sinR, cosR));
+			}
+
+			//! @brief		Scalar rotation of numSamples samples, used for the reference kernel and
+			//!				for vectors containing out-of-range angles.
+			//! @details	The FULL tier uses libm, so the SCALAR kernel is the reference for the others.
+			template <typename T, PolyAccuracy accuracy = PolyAccuracy::FULL>
+			inline void ScalarRotate(const T *x, const T *y, const T *theta,
+				T *outX, T *outY, size_t numSamples, bool inverse)
+			{
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					// Read inputs before writing, outputs are allowed to alias inputs
+					T xVal = x[i];
+					T yVal = y[i];
+					T sinTheta, cosTheta;
+					if(accuracy == PolyAccuracy::FULL)
+						SinCos(theta[i], &sinTheta, &cosTheta);
+					else
+						PolySinCos<accuracy>(theta[i], &sinTheta, &cosTheta);
+					if(inverse)
+						sinTheta = -sinTheta;
+
+					outX[i] = xVal*cosTheta + yVal*sinTheta;
+					outY[i] = yVal*cosTheta - xVal*sinTheta;
+				}
+			}
+
+			//! @brief		Rotates exactly VT::width samples.
+			template <class VT, PolyAccuracy accuracy>
+			inline void VecRotateBlock(const typename VT::T *x, const typename VT::T *y,
+				const typename VT::T *theta, typename VT::T *outX, typename VT::T *outY, bool inverse)
+			{
+				typedef typename VT::V V;
+				typedef PolyReduction<typename VT::T> R;
+
+				V thetaVec = VT::Load(theta);
+
+				// Written so that NaN also fails the test
+				if(!VT::AllTrue(VT::CmpLe(VT::Abs(thetaVec), VT::Set1(R::maxTheta))))
+				{
+					ScalarRotate<typename VT::T, accuracy>(x, y, theta, outX, outY, VT::width, inverse);
+					return;
+				}
+
+				V sinTheta, cosTheta;
+				VecSinCos<VT, accuracy>(thetaVec, &sinTheta, &cosTheta);
+				if(inverse)
+					sinTheta = VT::Sub(VT::Set1(0.0), sinTheta);
+
+				V xVec = VT::Load(x);
+				V yVec = VT::Load(y);
+				VT::Store(outX, VT::Fmadd(xVec, cosTheta, VT::Mul(yVec, sinTheta)));
+				VT::Store(outY, VT::Fnmadd(xVec, sinTheta, VT::Mul(yVec, cosTheta)));
+			}
+
+			//! @brief		Rotates numSamples samples. The tail is padded out to a full vector so
+			//!				every sample goes through the same code, whatever its position.
+			template <class VT, PolyAccuracy accuracy>
+			void VecRotate(const typename VT::T *x, const typename VT::T *y, const typename VT::T *theta,
+				typename VT::T *outX, typename VT::T *outY, size_t numSamples, bool inverse)
+			{
+				typedef typename VT::T T;
+
+				size_t i = 0;
+				for(; i + VT::width <= numSamples; i += VT::width)
+					VecRotateBlock<VT, accuracy>(x + i, y + i, theta + i, outX + i, outY + i, inverse);
+
+				if(i < numSamples)
+				{
+					T xBuff[VT::width] = {0}, yBuff[VT::width] = {0}, thetaBuff[VT::width] = {0};
+					size_t numLeft = numSamples - i;
+					for(size_t j = 0; j < numLeft; j++)
+					{
+						xBuff[j] = x[i + j];
+						yBuff[j] = y[i + j];
+						thetaBuff[j] = theta[i + j];
+					}
+					VecRotateBlock<VT, accuracy>(xBuff, yBuff, thetaBuff, xBuff, yBuff, inverse);
+					for(size_t j = 0; j < numLeft; j++)
+					{
+						outX[i + j] = xBuff[j];
+						outY[i + j] = yBuff[j];
+					}
+				}
+			}
+
+			//! @brief		Amplitude-invariant Clarke transform constants.
+			template <typename T> struct ClarkeConsts
+			{
+				static constexpr T oneThird = (T)(1.0/3.0);
+				static constexpr T twoThirds = (T)(2.0/3.0);
+				static constexpr T invSqrt3 = (T)0.57735026918962576451;
+			};
+
+			//! @brief		Scalar Clarke + forward Park of numSamples samples. Used for the
+			//!				reference kernel and for vectors containing out-of-range angles.
+			//! @details	c == NULL means two sensors (c = -a - b). zero may be NULL.
+			template <typename T>
+			inline void ScalarForwardFromAbc(const T *a, const T *b, const T *c, const T *theta,
+				T *d, T *q, T *zero, size_t numSamples)
+			{
+				typedef ClarkeConsts<T> K;
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					T aVal = a[i];
+					T bVal = b[i];
+					T alpha, beta, zeroVal;
+					if(c)
+					{
+						T cVal = c[i];
+						alpha = aVal*K::twoThirds - (bVal + cVal)*K::oneThird;
+						beta = (bVal - cVal)*K::invSqrt3;
+						zeroVal = (aVal + bVal + cVal)*K::oneThird;
+					}
+					else
+					{
+						alpha = aVal;
+						beta = (aVal + bVal + bVal)*K::invSqrt3;
+						zeroVal = 0;
+					}
+
+					T sinTheta, cosTheta;
+					SinCos(theta[i], &sinTheta, &cosTheta);
+					d[i] = alpha*cosTheta + beta*sinTheta;
+					q[i] = beta*cosTheta - alpha*sinTheta;
+					if(zero)
+						zero[i] = zeroVal;
+				}
+			}
+
+			//! @brief		Clarke + forward Park of exactly VT::width samples.
+			template <class VT>
+			inline void VecForwardFromAbcBlock(const typename VT::T *a, const typename VT::T *b,
+				const typename VT::T *c, const typename VT::T *theta, typename VT::T *d,
+				typename VT::T *q, typename VT::T *zero)
+			{
+				typedef typename VT::V V;
+				typedef ClarkeConsts<typename VT::T> K;
+
+				V thetaVec = VT::Load(theta);
+				if(!VT::AllTrue(VT::CmpLe(VT::Abs(thetaVec), VT::Set1(PolyReduction<typename VT::T>::maxTheta))))
+				{
+					ScalarForwardFromAbc(a, b, c, theta, d, q, zero, VT::width);
+					return;
+				}
+
+				V aVec = VT::Load(a);
+				V bVec = VT::Load(b);
+				V alpha, beta;
+				if(c)
+				{
+					V cVec = VT::Load(c);
+					V bPlusC = VT::Add(bVec, cVec);
+					alpha = VT::Fnmadd(bPlusC, VT::Set1(K::oneThird), VT::Mul(aVec, VT::Set1(K::twoThirds)));
+					beta = VT::Mul(VT::Sub(bVec, cVec), VT::Set1(K::invSqrt3));
+					if(zero)
+						VT::Store(zero, VT::Mul(VT::Add(aVec, bPlusC), VT::Set1(K::oneThird)));
+				}
+				else
+				{
+					alpha = aVec;
+					beta = VT::Mul(VT::Add(VT::Add(aVec, bVec), bVec), VT::Set1(K::invSqrt3));
+					if(zero)
+						VT::Store(zero, VT::Set1(0.0));
+				}
+
+				V sinTheta, cosTheta;
+				VecSinCos<VT, PolyAccuracy::FULL>(thetaVec, &sinTheta, &cosTheta);
+				VT::Store(d, VT::Fmadd(alpha, cosTheta, VT::Mul(beta, sinTheta)));
+				VT::Store(q, VT::Fnmadd(alpha, sinTheta, VT::Mul(beta, cosTheta)));
+			}
+
+			//! @brief		Clarke + forward Park of numSamples samples, tail padded like VecRotate().
+			template <class VT>
+			void VecForwardFromAbc(const typename VT::T *a, const typename VT::T *b,
+				const typename VT::T *c, const typename VT::T *theta, typename VT::T *d,
+				typename VT::T *q, typename VT::T *zero, size_t numSamples)
+			{
+				typedef typename VT::T T;
+
+				size_t i = 0;
+				for(; i + VT::width <= numSamples; i += VT::width)
+					VecForwardFromAbcBlock<VT>(a + i, b + i, c ? c + i : NULL, theta + i,
+						d + i, q + i, zero ? zero + i : NULL);
+
+				if(i < numSamples)
+				{
+					T aBuff[VT::width] = {0}, bBuff[VT::width] = {0}, cBuff[VT::width] = {0};
+					T thetaBuff[VT::width] = {0}, zeroBuff[VT::width] = {0};
+					size_t numLeft = numSamples - i;
+					for(size_t j = 0; j < numLeft; j++)
+					{
+						aBuff[j] = a[i + j];
+						bBuff[j] = b[i + j];
+						if(c)
+							cBuff[j] = c[i + j];
+						thetaBuff[j] = theta[i + j];
+					}
+					// d/q written over a/b, which have already been read
+					VecForwardFromAbcBlock<VT>(aBuff, bBuff, c ? cBuff : NULL, thetaBuff,
+						aBuff, bBuff, zeroBuff);
+					for(size_t j = 0; j < numLeft; j++)
+					{
+						d[i + j] = aBuff[j];
+						q[i + j] = bBuff[j];
+						if(zero)
+							zero[i + j] = zeroBuff[j];
+					}
+				}
+			}
+
+		} // namespace
+
+	} // namespace Simd
+} // namespace ParkTransform
+
+#endif // #ifndef PARK_TRANSFORM_SIMD_KERNELS_H
+
+// EOF
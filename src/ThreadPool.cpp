@@ -0,0 +1,174 @@
+//!
+//! @file 			ThreadPool.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Work-stealing thread pool.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// User includes
+#include "../include/ThreadPool.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	static uint64_t PackRange(uint32_t begin, uint32_t end)
+	{
+		return ((uint64_t)begin << 32) | end;
+	}
+
+	WorkStealingPool::WorkStealingPool(unsigned numThreads) :
+		_func(nullptr),
+		_context(nullptr),
+		_generation(0),
+		_numWorking(0),
+		_stop(false)
+	{
+		if(numThreads == 0)
+			numThreads = std::thread::hardware_concurrency();
+		if(numThreads == 0)
+			numThreads = 1;
+
+		_queues = std::vector<Queue>(numThreads);
+		for(unsigned i = 0; i < numThreads; i++)
+			_queues[i].range.store(0, std::memory_order_relaxed);
+
+		// Thread 0 is whoever calls Run()
+		for(unsigned i = 1; i < numThreads; i++)
+			_threads.push_back(std::thread(&WorkStealingPool::WorkerMain, this, i));
+	}
+
+	WorkStealingPool::~WorkStealingPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stop = true;
+		}
+		_startCondition.notify_all();
+		for(size_t i = 0; i < _threads.size(); i++)
+			_threads[i].join();
+	}
+
+	void WorkStealingPool::Run(ChunkFunc func, void *context, uint32_t numChunks)
+	{
+		const unsigned numThreads = GetNumThreads();
+
+		// Equal contiguous ranges, so with no stealing each thread streams through memory
+		for(unsigned i = 0; i < numThreads; i++)
+		{
+			uint32_t begin = (uint32_t)((uint64_t)numChunks*i/numThreads);
+			uint32_t end = (uint32_t)((uint64_t)numChunks*(i + 1)/numThreads);
+			_queues[i].range.store(PackRange(begin, end), std::memory_order_relaxed);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_func = func;
+			_context = context;
+			_numWorking = numThreads - 1;
+			_generation++;
+		}
+		_startCondition.notify_all();
+
+		Work(0);
+
+		// The workers may still be finishing chunks they took
+		std::unique_lock<std::mutex> lock(_mutex);
+		_doneCondition.wait(lock, [this]() { return _numWorking == 0; });
+	}
+
+	void WorkStealingPool::WorkerMain(unsigned index)
+	{
+		uint64_t lastGeneration = 0;
+		for(;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_startCondition.wait(lock, [&]() { return _stop || _generation != lastGeneration; });
+				if(_stop)
+					return;
+				lastGeneration = _generation;
+			}
+
+			Work(index);
+
+			bool isLast;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				isLast = (--_numWorking == 0);
+			}
+			if(isLast)
+				_doneCondition.notify_one();
+		}
+	}
+
+	void WorkStealingPool::Work(unsigned index)
+	{
+		uint32_t chunkIndex;
+		for(;;)
+		{
+			while(PopFront(_queues[index], &chunkIndex))
+				_func(_context, chunkIndex);
+			if(!StealHalf(index, &chunkIndex))
+				return;
+			_func(_context, chunkIndex);
+		}
+	}
+
+	bool WorkStealingPool::PopFront(Queue &queue, uint32_t *chunkIndex)
+	{
+		uint64_t range = queue.range.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			uint32_t begin = (uint32_t)(range >> 32), end = (uint32_t)range;
+			if(begin >= end)
+				return false;
+			if(queue.range.compare_exchange_weak(range, PackRange(begin + 1, end), std::memory_order_acq_rel))
+			{
+				*chunkIndex = begin;
+				return true;
+			}
+		}
+	}
+
+	bool WorkStealingPool::StealHalf(unsigned thiefIndex, uint32_t *chunkIndex)
+	{
+		const unsigned numThreads = GetNumThreads();
+		for(unsigned offset = 1; offset < numThreads; offset++)
+		{
+			Queue &victim = _queues[(thiefIndex + offset) % numThreads];
+			uint64_t range = victim.range.load(std::memory_order_relaxed);
+			for(;;)
+			{
+				uint32_t begin = (uint32_t)(range >> 32), end = (uint32_t)range;
+				if(begin >= end)
+					break;
+
+				// Take the back half (at least one), leaving the front to the victim
+				uint32_t mid = begin + (end - begin)/2;
+				if(victim.range.compare_exchange_weak(range, PackRange(begin, mid), std::memory_order_acq_rel))
+				{
+					// Run the first stolen chunk now, and make the rest stealable from us. Our own
+					// queue is empty, so nobody else is changing it.
+					*chunkIndex = mid;
+					_queues[thiefIndex].range.store(PackRange(mid + 1, end), std::memory_order_release);
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+} // namespace ParkTransform
+
+// EOF
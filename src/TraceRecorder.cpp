@@ -0,0 +1,172 @@
+//!
+//! @file 			TraceRecorder.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @edited 		n/a
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief 			Per-thread trace buffer registry and drain.
+//! @details
+//!					See README.rst
+
+//===============================================================================================//
+//========================================= INCLUDES ============================================//
+//===============================================================================================//
+
+// System includes
+#include <chrono>
+
+// User includes
+#include "../include/Config.hpp"
+#include "../include/TraceRecorder.hpp"
+
+//===============================================================================================//
+//======================================== NAMESPACE ============================================//
+//===============================================================================================//
+
+namespace ParkTransform
+{
+
+	//! Every buffer ever created, newest first. Only ever pushed to.
+	static std::atomic<TraceBuffer *> _buffers(nullptr);
+	static std::atomic<uint32_t> _numBuffers(0);
+
+	//! Held while draining, DrainTrace() is the single consumer of every buffer
+	static std::atomic_flag _draining = ATOMIC_FLAG_INIT;
+
+	//! Releases the thread's buffer for reuse when the thread exits
+	struct TraceBufferReleaser
+	{
+		std::atomic<bool> *owned = nullptr;
+
+		~TraceBufferReleaser()
+		{
+			if(owned)
+				owned->store(false, std::memory_order_release);
+		}
+	};
+
+	TraceBuffer::TraceBuffer() :
+		_numDropped(0),
+		_untilSample(0),
+		_head(0),
+		_tail(0),
+		_drainedNumDropped(0),
+		_owned(true),
+		_next(nullptr),
+		_index(0)
+	{
+		for(int i = 0; i < numTraceEvents; i++)
+		{
+			_callCounts[i].store(0, std::memory_order_relaxed);
+			_drainedCallCounts[i] = 0;
+		}
+		for(int i = 0; i < configPARK_TRACE_HISTOGRAM_BINS; i++)
+		{
+			_histogram[i].store(0, std::memory_order_relaxed);
+			_drainedHistogram[i] = 0;
+		}
+	}
+
+	TraceBuffer *TraceBuffer::Acquire()
+	{
+		static thread_local TraceBufferReleaser releaser;
+
+		// Reuse the buffer of a thread that has exited
+		TraceBuffer *buffer = _buffers.load(std::memory_order_acquire);
+		for(; buffer; buffer = buffer->_next)
+		{
+			bool owned = false;
+			if(buffer->_owned.compare_exchange_strong(owned, true, std::memory_order_acquire))
+				break;
+		}
+
+		if(!buffer)
+		{
+			buffer = new TraceBuffer();
+			buffer->_index = _numBuffers.fetch_add(1, std::memory_order_relaxed);
+			buffer->_next = _buffers.load(std::memory_order_relaxed);
+			while(!_buffers.compare_exchange_weak(buffer->_next, buffer, std::memory_order_release, std::memory_order_relaxed)) {}
+		}
+
+		releaser.owned = &buffer->_owned;
+		return buffer;
+	}
+
+	bool DrainTrace(TraceSink &sink)
+	{
+		if(_draining.test_and_set(std::memory_order_acquire))
+			return false;
+
+		// Static so a small drain task needs little stack. Only used while _draining is held.
+		static TraceCycleSample samples[configPARK_TRACE_RING_SIZE];
+		static TraceSnapshot snapshot;
+
+		for(TraceBuffer *buffer = _buffers.load(std::memory_order_acquire); buffer; buffer = buffer->_next)
+		{
+			bool isNew = false;
+			snapshot.bufferIndex = buffer->_index;
+
+			for(int i = 0; i < numTraceEvents; i++)
+			{
+				uint32_t count = buffer->_callCounts[i].load(std::memory_order_relaxed);
+				snapshot.callCounts[i] = count - buffer->_drainedCallCounts[i];
+				buffer->_drainedCallCounts[i] = count;
+				isNew |= (snapshot.callCounts[i] != 0);
+			}
+			for(int i = 0; i < configPARK_TRACE_HISTOGRAM_BINS; i++)
+			{
+				uint32_t count = buffer->_histogram[i].load(std::memory_order_relaxed);
+				snapshot.histogram[i] = count - buffer->_drainedHistogram[i];
+				buffer->_drainedHistogram[i] = count;
+			}
+			uint32_t numDropped = buffer->_numDropped.load(std::memory_order_relaxed);
+			snapshot.numDroppedSamples = numDropped - buffer->_drainedNumDropped;
+			buffer->_drainedNumDropped = numDropped;
+
+			// Pop the queued samples
+			uint32_t tail = buffer->_tail.load(std::memory_order_relaxed);
+			uint32_t head = buffer->_head.load(std::memory_order_acquire);
+			snapshot.numSamples = head - tail;
+			for(size_t i = 0; i < snapshot.numSamples; i++)
+				samples[i] = buffer->_samples[(tail + i) & (configPARK_TRACE_RING_SIZE - 1)];
+			buffer->_tail.store(head, std::memory_order_release);
+			snapshot.samples = samples;
+
+			if(isNew || snapshot.numSamples || snapshot.numDroppedSamples)
+				sink.OnTrace(snapshot);
+		}
+
+		_draining.clear(std::memory_order_release);
+		return true;
+	}
+
+	#if(configPARK_TRACE_DRAIN_THREAD == 1)
+		TraceDrainThread::TraceDrainThread(TraceSink &sink, unsigned periodMs) :
+			_sink(sink),
+			_periodMs(periodMs),
+			_stop(false),
+			_thread(&TraceDrainThread::Run, this)
+		{
+		}
+
+		TraceDrainThread::~TraceDrainThread()
+		{
+			_stop.store(true, std::memory_order_relaxed);
+			_thread.join();
+			// Anything recorded after the thread's last drain
+			while(!DrainTrace(_sink)) {}
+		}
+
+		void TraceDrainThread::Run()
+		{
+			while(!_stop.load(std::memory_order_relaxed))
+			{
+				DrainTrace(_sink);
+				std::this_thread::sleep_for(std::chrono::milliseconds(_periodMs));
+			}
+		}
+	#endif
+
+} // namespace ParkTransform
+
+// EOF
@@ -3,7 +3,7 @@
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @edited 		n/a
 //! @created		2012/10/09
-//! @last-modified 	2014/01/21
+//! @last-modified 	2026/10/17
 //! @brief 			Contains the forward and inverse Park transformations, used in BLDC motor control.
 //! @details
 //!					See the README in the repo root dir for more info.
@@ -22,20 +22,18 @@
 
 // GCC
 #include <math.h>
-#include <stdio.h>
 #include <stdlib.h>
 
 
 // User headers
+#define PARK_TRANSFORM_TRANSFORMER_CPP		// Compiles the double methods defined in Transformer.hpp
 #include "../include/Config.hpp"
 #include "../include/Transformer.hpp"
+#include "../include/Simd.hpp"
+#include "../include/BasicTransformer.hpp"
 
 
 
-#ifndef config_PRINT_DEBUG_PARK_TRANSFORM
-	#error Please define the switch config_PRINT_DEBUG_PARK_TRANSFORM
-#endif
-
 #ifndef CDP
 	#error Please define CDP. This is the bit place-value of the decimal point in a 32-bit fixed-point number. E.g. #define CDP 8 will give 8 bits of precision post DP, and 24 bits pre DP.
 #endif
@@ -47,117 +45,376 @@
 namespace ParkTransform
 {
 
-
-
-	#if(config_PRINT_DEBUG_PARK_TRANSFORM == 1)
-		//! Debug buffer
-		static char _debugBuff[100] = {0};
-	#endif
-
 	#if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
-		fp<CDP> _sinLut[configPARK_LUT_SIZE] = {(int32_t)0};
-		fp<CDP> _cosLut[configPARK_LUT_SIZE] = {(int32_t)0};
+		//! The sin and cos LUT's, built at compile time and stored in read-only data
+		#if(configPARK_LUT_QUARTER_WAVE == 1)
+			typedef SinCosLut<configPARK_LUT_SIZE, CDP, LutStorage::QUARTER_WAVE> Lut;
+		#else
+			typedef SinCosLut<configPARK_LUT_SIZE, CDP, LutStorage::FULL_WAVE> Lut;
+		#endif
+
+		static constexpr LutInterpolation lutInterpolation =
+			(configPARK_LUT_INTERPOLATION == 1) ? LutInterpolation::LINEAR : LutInterpolation::NONE;
+
+		//! How the fixed-point methods calculate sin/cos
+		#if(configPARK_USE_CORDIC == 1)
+			typedef CordicTrig<configPARK_CORDIC_ITERATIONS> FixedTrig;
+		#else
+			typedef LutTrig<Lut, lutInterpolation> FixedTrig;
+		#endif
+
+		//! Header-only kernels that the fixed-point methods forward to. theta is either measured
+		//! in LUT entries (the original interface) or a binary angle.
+		typedef BasicTransformer<Fp::fp<CDP>, LutPositionAngle<Fp::fp<CDP>, configPARK_LUT_SIZE>,
+			FixedTrig, Detail::LibraryTrace> FixedTransformer;
+		#if(PARK_TRANSFORM_FIXED_BAM_FUNCTIONS == 1)
+			typedef BasicTransformer<Fp::fp<CDP>, BamAngle<uint32_t>, FixedTrig, Detail::LibraryTrace> FixedBamTransformer;
+		#endif
 	#endif
 
 	//===============================================================================================//
 	//=====================================  METHOD DEFINITIONS =====================================//
 	//===============================================================================================//
 
-	//! @brief		Initialisation routines. Populates sin and cos LUT's.
-	//!				Call before calling any other functions in ParkTransform.
-	//! @note		Not thread-safe. Call from one task only.
-	//! @public		
 	void Transformer::Init()
 	{
-		#if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
+		// Nothing to do, the LUT's are generated at compile time
+	}
 
-			uint16_t i;
+	// The double scalar methods are defined in Transformer.hpp (so they can be made inline with
+	// config_PARK_TRANSFORM_HEADER_ONLY), and compiled here via PARK_TRANSFORM_TRANSFORMER_CPP
 
-			#if(config_PRINT_DEBUG_PARK_TRANSFORM == 1)
-				UartDebug::PutString("PARK: Start of sin LUT values:\r\n");
-			#endif
+	void Transformer::ForwardBatch(
+		const double *alpha,
+		const double *beta,
+		const double *theta,
+		double *d,
+		double *q,
+		size_t numSamples)
+	{
+		Simd::ForwardBatch(Simd::GetBestIsa(), alpha, beta, theta, d, q, numSamples);
+	}
 
-			for(i = 0; i < configPARK_LUT_SIZE; i++)
-			{
-				_sinLut[i] = fp<CDP>(sin(((double)i/(double)configPARK_LUT_SIZE)*2.0*PI));
-				#if(config_PRINT_DEBUG_PARK_TRANSFORM == 1)
-					snprintf(_debugBuff, sizeof(_debugBuff), " %f,", Fix2Float<CDP>(_sinLut[i].intValue));
-					UartDebug::PutString(_debugBuff);
-				#endif
-			}
+	void Transformer::ForwardBatch(
+		const float *alpha,
+		const float *beta,
+		const float *theta,
+		float *d,
+		float *q,
+		size_t numSamples)
+	{
+		Simd::ForwardBatch(Simd::GetBestIsa(), alpha, beta, theta, d, q, numSamples);
+	}
 
-			#if(config_PRINT_DEBUG_PARK_TRANSFORM == 1)
-				UartDebug::PutString("\r\nPARK: End of sin LUT values.\r\n");
-			#endif
+	void Transformer::InverseBatch(
+		const double *d,
+		const double *q,
+		const double *theta,
+		double *alpha,
+		double *beta,
+		size_t numSamples)
+	{
+		Simd::InverseBatch(Simd::GetBestIsa(), d, q, theta, alpha, beta, numSamples);
+	}
 
-			#if(config_PRINT_DEBUG_PARK_TRANSFORM == 1)
-				UartDebug::PutString("PARK: Start of cos LUT values:\r\n");
-			#endif
+	void Transformer::InverseBatch(
+		const float *d,
+		const float *q,
+		const float *theta,
+		float *alpha,
+		float *beta,
+		size_t numSamples)
+	{
+		Simd::InverseBatch(Simd::GetBestIsa(), d, q, theta, alpha, beta, numSamples);
+	}
 
-			for(i = 0; i < configPARK_LUT_SIZE; i++)
-			{
-				_cosLut[i] = fp<CDP>(cos(((double)i/(double)configPARK_LUT_SIZE)*2.0*PI));
-				#if(config_PRINT_DEBUG_PARK_TRANSFORM == 1)
-					snprintf(_debugBuff, sizeof(_debugBuff), " %f,", Fix2Float<CDP>(_cosLut[i].intValue));
-					UartDebug::PutString(_debugBuff);
-				#endif
-			}
+	void Transformer::ForwardFromABCBatch(
+		const double *a,
+		const double *b,
+		const double *c,
+		const double *theta,
+		double *d,
+		double *q,
+		double *zero,
+		size_t numSamples)
+	{
+		Simd::ForwardFromABCBatch(Simd::GetBestIsa(), a, b, c, theta, d, q, zero, numSamples);
+	}
 
-			#if(config_PRINT_DEBUG_PARK_TRANSFORM == 1)
-				UartDebug::PutString("\r\nPARK: End of cos LUT values.\r\n");
-			#endif
+	void Transformer::ForwardFromABCBatch(
+		const float *a,
+		const float *b,
+		const float *c,
+		const float *theta,
+		float *d,
+		float *q,
+		float *zero,
+		size_t numSamples)
+	{
+		Simd::ForwardFromABCBatch(Simd::GetBestIsa(), a, b, c, theta, d, q, zero, numSamples);
+	}
 
-		#endif // #if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
+	void Transformer::ForwardFromABBatch(
+		const double *a,
+		const double *b,
+		const double *theta,
+		double *d,
+		double *q,
+		size_t numSamples)
+	{
+		Simd::ForwardFromABBatch(Simd::GetBestIsa(), a, b, theta, d, q, numSamples);
 	}
 
-	void Transformer::Forward(double alpha, double beta, double theta, double *d, double *q)
+	void Transformer::ForwardFromABBatch(
+		const float *a,
+		const float *b,
+		const float *theta,
+		float *d,
+		float *q,
+		size_t numSamples)
 	{
-		// d = alpha*cos(theta) + beta*sin(theta)
-		// q = beta*cos(theta) - alpha*sin(theta)
-		*d = alpha*cos(theta) + beta*sin(theta);
-		*q = beta*cos(theta) - alpha*sin(theta);
+		Simd::ForwardFromABBatch(Simd::GetBestIsa(), a, b, theta, d, q, numSamples);
+	}
+
+	//! Angle differences a chunk at a time, then the SIMD Forward() kernel on them
+	template <typename T>
+	static void ReframeChunks(const T *d, const T *q, const T *thetaFrom, const T *thetaTo,
+		T *dOut, T *qOut, size_t numSamples)
+	{
+		const size_t chunkSize = 256;
+		T deltaTheta[chunkSize];
+		Simd::Isa isa = Simd::GetBestIsa();
+
+		for(size_t start = 0; start < numSamples; start += chunkSize)
+		{
+			size_t num = (numSamples - start < chunkSize) ? numSamples - start : chunkSize;
+			for(size_t i = 0; i < num; i++)
+				deltaTheta[i] = thetaTo[start + i] - thetaFrom[start + i];
+			Simd::ForwardBatch(isa, d + start, q + start, deltaTheta, dOut + start, qOut + start, num);
+		}
+	}
+
+	void Transformer::ReframeBatch(
+		const double *d,
+		const double *q,
+		const double *thetaFrom,
+		const double *thetaTo,
+		double *dOut,
+		double *qOut,
+		size_t numSamples)
+	{
+		ReframeChunks(d, q, thetaFrom, thetaTo, dOut, qOut, numSamples);
+	}
+
+	void Transformer::ReframeBatch(
+		const float *d,
+		const float *q,
+		const float *thetaFrom,
+		const float *thetaTo,
+		float *dOut,
+		float *qOut,
+		size_t numSamples)
+	{
+		ReframeChunks(d, q, thetaFrom, thetaTo, dOut, qOut, numSamples);
+	}
+
+	void Transformer::ForwardStream(
+		const double *alpha,
+		const double *beta,
+		double theta0,
+		double deltaTheta,
+		double *d,
+		double *q,
+		size_t numSamples)
+	{
+		// Rotations generated a chunk at a time, so the recurrence isn't interleaved with the
+		// loads/stores of the transform
+		const size_t chunkSize = 256;
+		Rotation<double> rotations[chunkSize];
+		RotationStream<double> stream(theta0, deltaTheta);
+
+		for(size_t start = 0; start < numSamples; start += chunkSize)
+		{
+			size_t num = (numSamples - start < chunkSize) ? numSamples - start : chunkSize;
+			stream.Generate(rotations, num);
+			for(size_t i = 0; i < num; i++)
+				Detail::DoubleTransformer::Forward(alpha[start + i], beta[start + i], rotations[i],
+					&d[start + i], &q[start + i]);
+		}
 	}
 
-	void Transformer::Inverse(
-		double d,
-		double q,
-		double theta,
+	void Transformer::InverseStream(
+		const double *d,
+		const double *q,
+		double theta0,
+		double deltaTheta,
 		double *alpha,
-		double *beta)
+		double *beta,
+		size_t numSamples)
 	{
-		// alpha = d*cos(theta) - q*sin(theta)
-		// beta  = q*cos(theta) + d*sin(theta)
-		*alpha= d*cos(theta) - q*sin(theta);
-		*beta = q*cos(theta) + d*sin(theta);
+		const size_t chunkSize = 256;
+		Rotation<double> rotations[chunkSize];
+		RotationStream<double> stream(theta0, deltaTheta);
+
+		for(size_t start = 0; start < numSamples; start += chunkSize)
+		{
+			size_t num = (numSamples - start < chunkSize) ? numSamples - start : chunkSize;
+			stream.Generate(rotations, num);
+			for(size_t i = 0; i < num; i++)
+				Detail::DoubleTransformer::Inverse(d[start + i], q[start + i], rotations[i],
+					&alpha[start + i], &beta[start + i]);
+		}
+	}
+
+	void Transformer::InverseSvpwmBatch(
+		const double *d,
+		const double *q,
+		const double *theta,
+		double *dutyA,
+		double *dutyB,
+		double *dutyC,
+		size_t numSamples)
+	{
+		// 2 x 2kB of alpha/beta per chunk, so they stay in L1 between the two passes
+		const size_t chunkSize = 256;
+		double alpha[chunkSize], beta[chunkSize];
+
+		for(size_t start = 0; start < numSamples; start += chunkSize)
+		{
+			size_t num = (numSamples - start < chunkSize) ? numSamples - start : chunkSize;
+			Simd::InverseBatch(Simd::GetBestIsa(), d + start, q + start, theta + start, alpha, beta, num);
+			for(size_t i = 0; i < num; i++)
+			{
+				Abc<double> duties = SvpwmDuties(alpha[i], beta[i]);
+				dutyA[start + i] = duties.a;
+				dutyB[start + i] = duties.b;
+				dutyC[start + i] = duties.c;
+			}
+		}
 	}
 
 	#if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
-		void Transformer::Forward(fp<CDP> alpha, fp<CDP> beta, fp<CDP> theta,
-			fp<CDP> *d, fp<CDP> *q)
+		void Transformer::Forward(Fp::fp<CDP> alpha, Fp::fp<CDP> beta, Fp::fp<CDP> theta,
+			Fp::fp<CDP> *d, Fp::fp<CDP> *q)
+		{
+			FixedTransformer::Forward(alpha, beta, theta, d, q);
+		}
+		
+		void Transformer::Inverse(
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				Fp::fp<CDP> theta,
+				Fp::fp<CDP> *alpha,
+				Fp::fp<CDP> *beta)
 		{
-			// Angle rounded to nearest degree
-			//! @todo Fix this loss in precision
-			*d = (alpha*_cosLut[theta.intValue>>CDP]) + (beta*_sinLut[theta.intValue>>CDP]);
+			FixedTransformer::Inverse(d, q, theta, alpha, beta);
+		}
 
-			#if(config_PRINT_DEBUG_PARK_TRANSFORM == 1)
-				snprintf(_debugBuff, sizeof(_debugBuff), "PARK: sin(theta) = %f, cos(theta) = %f\r\n",
-					Fix2Float<CDP>(_sinLut[theta.intValue>>CDP].intValue), Fix2Float<CDP>(_cosLut[theta.intValue>>CDP].intValue));
-				UartDebug::PutString(_debugBuff);
-			#endif
+		Rotation<Fp::fp<CDP> > Transformer::CalcRotation(Fp::fp<CDP> theta)
+		{
+			// theta is in units of LUT entries, so the integer part is the table index and the
+			// fractional part is only used when interpolating
+			return FixedTransformer::CalcRotation(theta);
+		}
 
-			*q = (beta*_cosLut[theta.intValue>>CDP]) - (alpha*_sinLut[theta.intValue>>CDP]);
+		#if(PARK_TRANSFORM_FIXED_BAM_FUNCTIONS == 1)
+		Rotation<Fp::fp<CDP> > Transformer::CalcRotationFp(Bam32 theta)
+		{
+			// Top bits of the angle index the LUT, the rest is the interpolation fraction
+			return FixedBamTransformer::CalcRotation(theta);
 		}
-		
+
+		void Transformer::Forward(
+				Fp::fp<CDP> alpha,
+				Fp::fp<CDP> beta,
+				Bam32 theta,
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q)
+		{
+			FixedBamTransformer::Forward(alpha, beta, theta, d, q);
+		}
+
 		void Transformer::Inverse(
-				fp<CDP> d,
-				fp<CDP> q,
-				fp<CDP> theta,
-				fp<CDP> *alpha,
-				fp<CDP> *beta)
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				Bam32 theta,
+				Fp::fp<CDP> *alpha,
+				Fp::fp<CDP> *beta)
+		{
+			FixedBamTransformer::Inverse(d, q, theta, alpha, beta);
+		}
+		#endif
+
+		void Transformer::Forward(
+				Fp::fp<CDP> alpha,
+				Fp::fp<CDP> beta,
+				const Rotation<Fp::fp<CDP> > &rotation,
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q)
 		{
+			FixedTransformer::Forward(alpha, beta, rotation, d, q);
+		}
+
+		void Transformer::Inverse(
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				const Rotation<Fp::fp<CDP> > &rotation,
+				Fp::fp<CDP> *alpha,
+				Fp::fp<CDP> *beta)
+		{
+			FixedTransformer::Inverse(d, q, rotation, alpha, beta);
+		}
 
-			*alpha= d*_cosLut[theta.intValue>>CDP] - q*_sinLut[theta.intValue>>CDP];
-			*beta = q*_cosLut[theta.intValue>>CDP] + d*_sinLut[theta.intValue>>CDP];
+		void Transformer::ForwardFromABC(
+				Fp::fp<CDP> a,
+				Fp::fp<CDP> b,
+				Fp::fp<CDP> c,
+				Fp::fp<CDP> theta,
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q,
+				Fp::fp<CDP> *zero)
+		{
+			Dq0<Fp::fp<CDP> > dq0 = FixedTransformer::ForwardFromABC(a, b, c, theta);
+			*d = dq0.d;
+			*q = dq0.q;
+			*zero = dq0.zero;
+		}
+
+		void Transformer::ForwardFromAB(
+				Fp::fp<CDP> a,
+				Fp::fp<CDP> b,
+				Fp::fp<CDP> theta,
+				Fp::fp<CDP> *d,
+				Fp::fp<CDP> *q)
+		{
+			Dq<Fp::fp<CDP> > dq = FixedTransformer::ForwardFromAB(a, b, theta);
+			*d = dq.d;
+			*q = dq.q;
+		}
+
+		void Transformer::InverseSvpwm(
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				Fp::fp<CDP> theta,
+				Fp::fp<CDP> *dutyA,
+				Fp::fp<CDP> *dutyB,
+				Fp::fp<CDP> *dutyC)
+		{
+			Abc<Fp::fp<CDP> > duties = FixedTransformer::InverseSvpwm(d, q, theta);
+			*dutyA = duties.a;
+			*dutyB = duties.b;
+			*dutyC = duties.c;
+		}
+
+		void Transformer::Reframe(
+				Fp::fp<CDP> d,
+				Fp::fp<CDP> q,
+				Fp::fp<CDP> thetaFrom,
+				Fp::fp<CDP> thetaTo,
+				Fp::fp<CDP> *dOut,
+				Fp::fp<CDP> *qOut)
+		{
+			FixedTransformer::Reframe(d, q, thetaFrom, thetaTo, dOut, qOut);
 		}
 
 	#endif // #if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
@@ -0,0 +1,161 @@
+//!
+//! @file 			AbcTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the fused Clarke + Park (abc to dq0) functions.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(AbcTests)
+	{
+		using namespace ParkTransform;
+		using ParkTransform::Simd::Isa;
+
+		const size_t numSamples = 1003;		// Not a multiple of any vector width, to exercise the tail
+		const Isa isas[] = { Isa::SCALAR, Isa::AVX2, Isa::AVX512 };
+
+		//! Separate Clarke transform, then Forward(), as done before the fused functions existed
+		static void Reference(double a, double b, double c, double theta, double *d, double *q, double *zero)
+		{
+			double alpha = (2.0*a - b - c)/3.0;
+			double beta = (b - c)/sqrt(3.0);
+			*d = alpha*cos(theta) + beta*sin(theta);
+			*q = beta*cos(theta) - alpha*sin(theta);
+			*zero = (a + b + c)/3.0;
+		}
+
+		TEST(BalancedSetGivesConstantDq)
+		{
+			// Balanced currents, amplitude 2, lagging the rotor by 30 degrees
+			Transformer transformer;
+			for(int i = 0; i < 50; i++)
+			{
+				double theta = 0.13*i;
+				double phase = theta - M_PI/6.0;
+				Dq0<double> dq0 = transformer.ForwardFromABC(2.0*cos(phase), 2.0*cos(phase - 2.0*M_PI/3.0),
+					2.0*cos(phase + 2.0*M_PI/3.0), theta);
+				CHECK_CLOSE(2.0*cos(M_PI/6.0), dq0.d, 1e-12);
+				CHECK_CLOSE(-2.0*sin(M_PI/6.0), dq0.q, 1e-12);
+				CHECK_CLOSE(0.0, dq0.zero, 1e-12);
+			}
+		}
+
+		TEST(MatchesSeparateClarkeAndPark)
+		{
+			Transformer transformer;
+			double d, q, zero, refD, refQ, refZero;
+			transformer.ForwardFromABC(0.9, -0.2, -0.4, 2.3, &d, &q, &zero);
+			Reference(0.9, -0.2, -0.4, 2.3, &refD, &refQ, &refZero);
+			CHECK_CLOSE(refD, d, 1e-12);
+			CHECK_CLOSE(refQ, q, 1e-12);
+			CHECK_CLOSE(refZero, zero, 1e-12);
+		}
+
+		TEST(TwoSensorMatchesThreeSensor)
+		{
+			Transformer transformer;
+			Dq<double> dq = transformer.ForwardFromAB(0.9, -0.2, 2.3);
+			Dq0<double> dq0 = transformer.ForwardFromABC(0.9, -0.2, -0.7, 2.3);
+			CHECK_CLOSE(dq0.d, dq.d, 1e-12);
+			CHECK_CLOSE(dq0.q, dq.q, 1e-12);
+		}
+
+		TEST(Q15Lut)
+		{
+			typedef BasicTransformer<Q15, BamAngle<uint16_t>,
+				LutTrig<SinCosLut<256, 15>, LutInterpolation::LINEAR> > Q15Transformer;
+			typedef ScalarTraits<Q15> S;
+
+			// Large phase values, which would saturate if summed before scaling
+			double d, q, zero;
+			Reference(0.9, -0.6, -0.3, 1.0, &d, &q, &zero);
+			Dq0<Q15> dq0 = Q15Transformer::ForwardFromABC(S::FromDouble(0.9), S::FromDouble(-0.6),
+				S::FromDouble(-0.3), Bam16::FromRadians(1.0));
+			CHECK_CLOSE(d, S::ToDouble(dq0.d), 5e-4);
+			CHECK_CLOSE(q, S::ToDouble(dq0.q), 5e-4);
+			CHECK_CLOSE(zero, S::ToDouble(dq0.zero), 5e-4);
+
+			Dq<Q15> dq = Q15Transformer::ForwardFromAB(S::FromDouble(0.9), S::FromDouble(-0.6),
+				Bam16::FromRadians(1.0));
+			CHECK_CLOSE(d, S::ToDouble(dq.d), 5e-4);
+			CHECK_CLOSE(q, S::ToDouble(dq.q), 5e-4);
+		}
+
+		TEST(BatchKernelsMatchScalar)
+		{
+			static double a[numSamples], b[numSamples], c[numSamples], theta[numSamples];
+			static double d[numSamples], q[numSamples], zero[numSamples];
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				a[i] = cos(0.37*i);
+				b[i] = 1.5*sin(0.11*i);
+				c[i] = 0.2 - a[i] - b[i];
+				theta[i] = -400.0 + 0.8*i;
+			}
+			theta[5] = 1e7;		// Scalar fallback
+
+			for(size_t k = 0; k < sizeof(isas)/sizeof(isas[0]); k++)
+			{
+				if(!ParkTransform::Simd::IsSupported(isas[k]))
+					continue;
+
+				ParkTransform::Simd::ForwardFromABCBatch(isas[k], a, b, c, theta, d, q, zero, numSamples);
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					double refD, refQ, refZero;
+					Reference(a[i], b[i], c[i], theta[i], &refD, &refQ, &refZero);
+					double tol = 1e-12*(fabs(a[i]) + fabs(b[i]) + fabs(c[i]));
+					CHECK_CLOSE(refD, d[i], tol);
+					CHECK_CLOSE(refQ, q[i], tol);
+					CHECK_CLOSE(refZero, zero[i], tol);
+				}
+
+				ParkTransform::Simd::ForwardFromABBatch(isas[k], a, b, theta, d, q, numSamples);
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					double refD, refQ, refZero;
+					Reference(a[i], b[i], -a[i] - b[i], theta[i], &refD, &refQ, &refZero);
+					double tol = 1e-12*(fabs(a[i]) + fabs(b[i]));
+					CHECK_CLOSE(refD, d[i], tol);
+					CHECK_CLOSE(refQ, q[i], tol);
+				}
+			}
+		}
+
+		TEST(FloatBatchInPlace)
+		{
+			static float a[numSamples], b[numSamples], theta[numSamples];
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				a[i] = (float)cos(0.37*i);
+				b[i] = (float)sin(0.11*i);
+				theta[i] = (float)(0.01*i);
+			}
+
+			Transformer transformer;
+			static float aIn[numSamples], bIn[numSamples];
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				aIn[i] = a[i];
+				bIn[i] = b[i];
+			}
+			transformer.ForwardFromABBatch(a, b, theta, a, b, numSamples);
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				Dq<double> dq = transformer.ForwardFromAB(aIn[i], bIn[i], theta[i]);
+				CHECK_CLOSE(dq.d, a[i], 1e-5);
+				CHECK_CLOSE(dq.q, b[i], 1e-5);
+			}
+		}
+
+	} // SUITE(AbcTests)
+} // namespace ParkTransformTest
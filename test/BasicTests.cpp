@@ -2,11 +2,14 @@
 //! @file 			BaiscTests.cpp
 //! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
 //! @created		2014/01/21
-//! @last-modified 	2014/01/21
+//! @last-modified 	2026/10/17
 //! @brief			Basic Park transformation tests.
 //! @details
 //!					See README.rst in root dir for more info.
 
+#include <float.h>
+#include <math.h>
+
 #include "../api/ParkTransform.hpp"
 
 #include "../lib/UnitTest++/src/UnitTest++.h"
@@ -42,5 +45,32 @@ namespace ParkTransformTest
 			CHECK_CLOSE(1.0, q, 0.05);
 		}
 
+		TEST(FusedSinCosMatchesSeparateCalls)
+		{
+			ParkTransform::Transformer parkTransformer;
+
+			// The fused sincos() path must give the same results as the original formulation
+			// with separate sin() and cos() calls. Not bit-exact, as either side may have its
+			// multiply-adds contracted into FMA's (-ffp-contract=fast, the GCC default on targets
+			// with FMA), which rounds once instead of twice: within 2 ulp of the larger product.
+			for(int i = -1000; i <= 1000; i++)
+			{
+				double alpha = 1.0 + 0.001*i;
+				double beta = -0.5 + 0.002*i;
+				double theta = 0.0137*i;
+				double tol = 2.0*DBL_EPSILON*(fabs(alpha) + fabs(beta));
+
+				double d, q;
+				parkTransformer.Forward(alpha, beta, theta, &d, &q);
+				CHECK_CLOSE(alpha*cos(theta) + beta*sin(theta), d, tol);
+				CHECK_CLOSE(beta*cos(theta) - alpha*sin(theta), q, tol);
+
+				double a, b;
+				parkTransformer.Inverse(alpha, beta, theta, &a, &b);
+				CHECK_CLOSE(alpha*cos(theta) - beta*sin(theta), a, tol);
+				CHECK_CLOSE(beta*cos(theta) + alpha*sin(theta), b, tol);
+			}
+		}
+
 	} // SUITE(BaiscTests)
 } // namespace ParkTransformTest
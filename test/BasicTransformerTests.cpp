@@ -0,0 +1,127 @@
+//!
+//! @file 			BasicTransformerTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the templated BasicTransformer, across scalar types and policies.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(BasicTransformerTests)
+	{
+		using namespace ParkTransform;
+
+		//! Runs Forward() then Inverse() for a spread of inputs and compares with double maths.
+		//! makeAngle converts radians to the transformer's angle type.
+		template <class Transformer, class MakeAngle>
+		static void CheckAgainstDouble(MakeAngle makeAngle, double tol)
+		{
+			typedef typename Transformer::scalar_type T;
+			typedef ScalarTraits<T> S;
+
+			for(int i = 0; i < 100; i++)
+			{
+				double alpha = 0.6*cos(0.31*i);
+				double beta = 0.6*sin(0.17*i);
+				double theta = 0.0631*i;
+
+				T d, q;
+				Transformer::Forward(S::FromDouble(alpha), S::FromDouble(beta), makeAngle(theta), &d, &q);
+				CHECK_CLOSE(alpha*cos(theta) + beta*sin(theta), S::ToDouble(d), tol);
+				CHECK_CLOSE(beta*cos(theta) - alpha*sin(theta), S::ToDouble(q), tol);
+
+				T a, b;
+				Transformer::Inverse(d, q, makeAngle(theta), &a, &b);
+				CHECK_CLOSE(alpha, S::ToDouble(a), 2.0*tol);
+				CHECK_CLOSE(beta, S::ToDouble(b), 2.0*tol);
+			}
+		}
+
+		static double Radians(double theta) { return theta; }
+		static float RadiansF(double theta) { return (float)theta; }
+		static Bam16 ToBam16(double theta) { return Bam16::FromRadians(theta); }
+		static Bam32 ToBam32(double theta) { return Bam32::FromRadians(theta); }
+
+		TEST(DoubleLibm)
+		{
+			CheckAgainstDouble<BasicTransformer<double> >(Radians, 1e-12);
+		}
+
+		TEST(FloatLibm)
+		{
+			CheckAgainstDouble<BasicTransformer<float> >(RadiansF, 1e-5);
+		}
+
+		TEST(FloatLut)
+		{
+			typedef LutTrig<SinCosLut<1024, 24, LutStorage::QUARTER_WAVE>, LutInterpolation::LINEAR> Trig;
+			CheckAgainstDouble<BasicTransformer<float, BamAngle<uint32_t>, Trig> >(ToBam32, 1e-5);
+		}
+
+		TEST(Q15Lut)
+		{
+			typedef LutTrig<SinCosLut<256, 15>, LutInterpolation::LINEAR> Trig;
+			CheckAgainstDouble<BasicTransformer<Q15, BamAngle<uint16_t>, Trig> >(ToBam16, 5e-4);
+		}
+
+		TEST(Q31Lut)
+		{
+			typedef LutTrig<SinCosLut<4096, 30>, LutInterpolation::LINEAR> Trig;
+			CheckAgainstDouble<BasicTransformer<Q31, BamAngle<uint32_t>, Trig> >(ToBam32, 1e-6);
+		}
+
+		TEST(LutPositionAngleMatchesOriginalIndexing)
+		{
+			// Same representation as the original fp<CDP> functions: 24.8 fixed point, theta in LUT entries
+			typedef QFixed<int32_t, 8> Fixed;
+			typedef SinCosLut<256, 8> Lut;
+			typedef BasicTransformer<Fixed, LutPositionAngle<Fixed, 256>, LutTrig<Lut> > FixedTransformer;
+
+			Fixed theta;
+			theta.raw = (64 << 8) + 100;	// 64.4 entries, truncated to entry 64 = pi/2
+			Rotation<Fixed> rotation = FixedTransformer::CalcRotation(theta);
+			CHECK_EQUAL(Lut::Cos(64), rotation.cosTheta.raw);
+			CHECK_EQUAL(Lut::Sin(64), rotation.sinTheta.raw);
+		}
+
+		TEST(Q15Saturates)
+		{
+			typedef ScalarTraits<Q15> S;
+			CHECK_EQUAL(32767, S::Add(S::FromDouble(0.75), S::FromDouble(0.75)).raw);
+			CHECK_EQUAL(-32768, S::Sub(S::FromDouble(-0.75), S::FromDouble(0.75)).raw);
+			CHECK_EQUAL(32767, S::FromRaw(1 << 15, 15).raw);
+		}
+
+		TEST(ByValueMatchesOutPointers)
+		{
+			Transformer transformer;
+			double d, q, alpha, beta;
+			transformer.Forward(0.3, -0.7, 1.1, &d, &q);
+			Dq<double> dq = transformer.Forward(0.3, -0.7, 1.1);
+			CHECK_EQUAL(d, dq.d);
+			CHECK_EQUAL(q, dq.q);
+
+			transformer.Inverse(d, q, 1.1, &alpha, &beta);
+			AlphaBeta<double> ab = transformer.Inverse(dq.d, dq.q, 1.1);
+			CHECK_EQUAL(alpha, ab.alpha);
+			CHECK_EQUAL(beta, ab.beta);
+		}
+
+		TEST(ByValueIsConstexpr)
+		{
+			// A quarter turn: d = beta, q = -alpha
+			constexpr Dq<double> dq = BasicTransformer<double>::Forward(1.0, 2.0, Rotation<double>(0.0, 1.0));
+			static_assert(dq.d == 2.0 && dq.q == -1.0, "constexpr Forward()");
+			CHECK_EQUAL(2.0, dq.d);
+		}
+
+	} // SUITE(BasicTransformerTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,95 @@
+//!
+//! @file 			BatchTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the batched (array) Park transformations.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(BatchTests)
+	{
+		const size_t numSamples = 1000;
+
+		TEST(ForwardBatchMatchesScalar)
+		{
+			ParkTransform::Transformer parkTransformer;
+
+			static double alpha[numSamples], beta[numSamples], theta[numSamples];
+			static double d[numSamples], q[numSamples];
+
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				alpha[i] = cos(0.01*i);
+				beta[i] = 0.5*sin(0.02*i) - 0.25;
+				theta[i] = -10.0 + 0.02*i;
+			}
+
+			parkTransformer.ForwardBatch(alpha, beta, theta, d, q, numSamples);
+
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				double dExp, qExp;
+				parkTransformer.Forward(alpha[i], beta[i], theta[i], &dExp, &qExp);
+				double tol = 1e-12*(fabs(alpha[i]) + fabs(beta[i]));
+				CHECK_CLOSE(dExp, d[i], tol);
+				CHECK_CLOSE(qExp, q[i], tol);
+			}
+		}
+
+		TEST(InverseBatchMatchesScalar)
+		{
+			ParkTransform::Transformer parkTransformer;
+
+			static double d[numSamples], q[numSamples], theta[numSamples];
+			static double alpha[numSamples], beta[numSamples];
+
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				d[i] = 2.0 - 0.003*i;
+				q[i] = sin(0.05*i);
+				theta[i] = 0.007*i;
+			}
+
+			parkTransformer.InverseBatch(d, q, theta, alpha, beta, numSamples);
+
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				double alphaExp, betaExp;
+				parkTransformer.Inverse(d[i], q[i], theta[i], &alphaExp, &betaExp);
+				double tol = 1e-12*(fabs(d[i]) + fabs(q[i]));
+				CHECK_CLOSE(alphaExp, alpha[i], tol);
+				CHECK_CLOSE(betaExp, beta[i], tol);
+			}
+		}
+
+		TEST(BatchInPlace)
+		{
+			ParkTransform::Transformer parkTransformer;
+
+			double a[3] = { 1.0, 0.0, -1.0 };
+			double b[3] = { 0.0, 1.0, 0.5 };
+			double theta[3] = { 0.3, 1.2, -2.0 };
+
+			// Forward then inverse in-place should get back the original values
+			parkTransformer.ForwardBatch(a, b, theta, a, b, 3);
+			parkTransformer.InverseBatch(a, b, theta, a, b, 3);
+
+			CHECK_CLOSE(1.0, a[0], 1e-12);
+			CHECK_CLOSE(0.0, b[0], 1e-12);
+			CHECK_CLOSE(0.0, a[1], 1e-12);
+			CHECK_CLOSE(1.0, b[1], 1e-12);
+			CHECK_CLOSE(-1.0, a[2], 1e-12);
+			CHECK_CLOSE(0.5, b[2], 1e-12);
+		}
+
+	} // SUITE(BatchTests)
+} // namespace ParkTransformTest
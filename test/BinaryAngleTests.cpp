@@ -0,0 +1,73 @@
+//!
+//! @file 			BinaryAngleTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for binary angles and binary angle LUT lookups.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(BinaryAngleTests)
+	{
+		using ParkTransform::Bam16;
+		using ParkTransform::Bam32;
+
+		TEST(WrapsWithIntegerOverflow)
+		{
+			CHECK(Bam16(0xFFFF) + Bam16(1) == Bam16(0));
+			CHECK(Bam16(0) - Bam16(0x4000) == Bam16(0xC000));
+			// Mechanical to electrical angle, 4 pole pairs
+			CHECK(Bam16(0x5000)*4 == Bam16(0x4000));
+		}
+
+		TEST(ConvertsRadiansAndEncoderCounts)
+		{
+			CHECK_EQUAL(0x4000, Bam16::FromRadians(M_PI/2.0).value);
+			CHECK_EQUAL(0xC000, Bam16::FromRadians(-M_PI/2.0).value);
+			CHECK_EQUAL(0u, Bam32::FromRadians(2.0*M_PI).value);
+			CHECK_CLOSE(M_PI, Bam32(0x80000000u).ToRadians(), 1e-12);
+
+			// 1024 count encoder, exact shift
+			CHECK_EQUAL(256u << 22, Bam32::FromEncoder(256, 1024).value);
+			// 1000 count encoder, wraps
+			CHECK_EQUAL(0x4000, Bam16::FromEncoder(1250, 1000).value);
+
+			// Widening is exact
+			Bam32 wide = Bam16(0x1234);
+			CHECK_EQUAL(0x12340000u, wide.value);
+		}
+
+		TEST(LutLookupMatchesLibm)
+		{
+			typedef ParkTransform::SinCosLut<256, 16> Lut;
+			for(uint32_t i = 0; i < 65536; i += 13)
+			{
+				int32_t sinRaw, cosRaw;
+				ParkTransform::LutSinCos<Lut, ParkTransform::LutInterpolation::LINEAR>(Bam16((uint16_t)i), &sinRaw, &cosRaw);
+				double angle = 2.0*M_PI*i/65536.0;
+				CHECK_CLOSE(sin(angle), sinRaw/65536.0, 1e-4);
+				CHECK_CLOSE(cos(angle), cosRaw/65536.0, 1e-4);
+			}
+		}
+
+		TEST(ForwardWithBinaryAngle)
+		{
+			ParkTransform::Transformer parkTransformer;
+
+			double d1, q1, d2, q2;
+			parkTransformer.Forward(0.3, 0.8, Bam16(0x2000), &d1, &q1);
+			parkTransformer.Forward(0.3, 0.8, M_PI/4.0, &d2, &q2);
+			CHECK_CLOSE(d2, d1, 1e-12);
+			CHECK_CLOSE(q2, q1, 1e-12);
+		}
+
+	} // SUITE(BinaryAngleTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,186 @@
+//!
+//! @file 			CordicTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Accuracy of the CORDIC rotation, vectoring and sin/cos, and the CORDIC trig policy.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(CordicTests)
+	{
+		using namespace ParkTransform;
+
+		//! Max error over angles spread across the whole turn, including the fold boundaries
+		template <int numIterations>
+		static double MaxError()
+		{
+			double maxError = 0.0;
+			for(uint32_t i = 0; i < 20000; i++)
+			{
+				Bam32 theta((uint32_t)(i*214748u + (i & 3)*0x40000000u));
+				int32_t sinRaw, cosRaw;
+				Cordic<numIterations>::SinCos(theta, &sinRaw, &cosRaw);
+				maxError = fmax(maxError, fabs(sin(theta.ToRadians()) - ldexp(sinRaw, -30)));
+				maxError = fmax(maxError, fabs(cos(theta.ToRadians()) - ldexp(cosRaw, -30)));
+			}
+			return maxError;
+		}
+
+		TEST(ErrorBoundsPerIterationCount)
+		{
+			// The bounds documented in Cordic.hpp
+			CHECK(MaxError<8>() < 8e-3);
+			CHECK(MaxError<16>() < 3.1e-5);
+			CHECK(MaxError<24>() < 1.5e-7);
+			CHECK(MaxError<30>() < 2e-8);
+		}
+
+		TEST(ExactQuadrants)
+		{
+			int32_t sinRaw, cosRaw;
+			Cordic<30>::SinCos(Bam32(0x40000000u), &sinRaw, &cosRaw);		// 90 degrees
+			CHECK_CLOSE(1.0, ldexp(sinRaw, -30), 1e-8);
+			CHECK_CLOSE(0.0, ldexp(cosRaw, -30), 1e-8);
+			Cordic<30>::SinCos(Bam32(0x80000000u), &sinRaw, &cosRaw);		// 180 degrees
+			CHECK_CLOSE(0.0, ldexp(sinRaw, -30), 1e-8);
+			CHECK_CLOSE(-1.0, ldexp(cosRaw, -30), 1e-8);
+		}
+
+		TEST(Q31Transformer)
+		{
+			typedef BasicTransformer<Q31, BamAngle<uint32_t>, CordicTrig<24> > CordicTransformer;
+			typedef ScalarTraits<Q31> S;
+
+			for(int i = 0; i < 100; i++)
+			{
+				double alpha = 0.6*cos(0.31*i), beta = 0.6*sin(0.17*i), theta = 0.0631*i;
+				Q31 d, q;
+				CordicTransformer::Forward(S::FromDouble(alpha), S::FromDouble(beta), Bam32::FromRadians(theta), &d, &q);
+				CHECK_CLOSE(alpha*cos(theta) + beta*sin(theta), S::ToDouble(d), 5e-7);
+				CHECK_CLOSE(beta*cos(theta) - alpha*sin(theta), S::ToDouble(q), 5e-7);
+			}
+		}
+
+		TEST(RotateMatchesExactRotation)
+		{
+			// Any raw format, up to full scale in both components
+			double maxError = 0.0;
+			for(uint32_t i = 0; i < 20000; i++)
+			{
+				int32_t x = (int32_t)(i*2654435761u);
+				int32_t y = (int32_t)(i*40503u*65537u + 12345u);
+				Bam32 theta((uint32_t)(i*214748u + (i & 3)*0x40000000u));
+				int64_t xOut, yOut;
+				Cordic<24>::Rotate(x, y, theta, &xOut, &yOut);
+
+				double radians = theta.ToRadians();
+				double magnitude = hypot((double)x, (double)y);
+				maxError = fmax(maxError, fabs(x*cos(radians) - y*sin(radians) - (double)xOut)/magnitude);
+				maxError = fmax(maxError, fabs(y*cos(radians) + x*sin(radians) - (double)yOut)/magnitude);
+			}
+			// Same bound as SinCos(), relative to the magnitude
+			CHECK(maxError < 1.5e-7);
+		}
+
+		TEST(VectorFindsAngleAndMagnitude)
+		{
+			for(int i = 0; i < 1000; i++)
+			{
+				double radians = 0.00731*i*i - LutMaths::pi;
+				double magnitude = (i == 0) ? 2147483647.0*1.41421356 : 1e3 + 2e6*i;
+				int32_t x = (int32_t)fmax(fmin(magnitude*cos(radians), 2147483647.0), -2147483648.0);
+				int32_t y = (int32_t)fmax(fmin(magnitude*sin(radians), 2147483647.0), -2147483648.0);
+
+				Bam32 angle;
+				uint32_t magnitudeOut;
+				Cordic<24>::Vector(x, y, &angle, &magnitudeOut);
+				double error = remainder(atan2((double)y, (double)x) - angle.ToRadians(), 2.0*LutMaths::pi);
+				CHECK_CLOSE(0.0, error, 2e-7);
+				CHECK_CLOSE(hypot((double)x, (double)y), (double)magnitudeOut, 2e-7*hypot((double)x, (double)y) + 1.0);
+			}
+		}
+
+		TEST(Q31TransformerRotatesDirectly)
+		{
+			typedef BasicTransformer<Q31, BamAngle<uint32_t>, CordicTrig<24> > CordicTransformer;
+			typedef ScalarTraits<Q31> S;
+			CHECK((TrigRotatesVector<CordicTrig<24>, Q31>::value));
+			CHECK(!(TrigRotatesVector<CordicTrig<24>, double>::value));
+			CHECK(!(TrigRotatesVector<LibmTrig, Q31>::value));
+
+			// The same rotation as through CalcRotation(), to within CORDIC's error
+			for(int i = 0; i < 100; i++)
+			{
+				Q31 alpha = S::FromDouble(0.7*cos(0.29*i)), beta = S::FromDouble(-0.7*sin(0.13*i));
+				Bam32 theta = Bam32::FromRadians(0.0917*i);
+				Dq<Q31> direct = CordicTransformer::Forward(alpha, beta, theta);
+				Dq<Q31> viaSinCos = CordicTransformer::Forward(alpha, beta, CordicTransformer::CalcRotation(theta));
+				CHECK_CLOSE(S::ToDouble(viaSinCos.d), S::ToDouble(direct.d), 5e-7);
+				CHECK_CLOSE(S::ToDouble(viaSinCos.q), S::ToDouble(direct.q), 5e-7);
+
+				AlphaBeta<Q31> ab = CordicTransformer::Inverse(direct.d, direct.q, theta);
+				CHECK_CLOSE(S::ToDouble(alpha), S::ToDouble(ab.alpha), 1e-6);
+				CHECK_CLOSE(S::ToDouble(beta), S::ToDouble(ab.beta), 1e-6);
+			}
+
+			// |(0.9, 0.9)| > 1, so d saturates at 45 degrees
+			Q31 d, q;
+			CordicTransformer::Forward(S::FromDouble(0.9), S::FromDouble(0.9), Bam32(0x20000000u), &d, &q);
+			CHECK_EQUAL(INT32_MAX, d.raw);
+			CHECK_CLOSE(0.0, S::ToDouble(q), 1e-6);
+		}
+
+		TEST(FixedPointConfigRotationOverloadsAgree)
+		{
+			// The kernel behind Transformer's fixed-point functions with configPARK_USE_CORDIC 1,
+			// with QFixed standing in for Fp::fp<CDP> (see also 'make testFixedCordic')
+			typedef QFixed<int32_t, CDP> Fixed;
+			typedef BasicTransformer<Fixed, LutPositionAngle<Fixed, configPARK_LUT_SIZE>,
+				CordicTrig<configPARK_CORDIC_ITERATIONS> > FixedTransformer;
+			typedef ScalarTraits<Fixed> S;
+
+			// A few LSB's of rounding, plus CORDIC's angle error on a magnitude of 1.5
+			const double tolerance = 4.0/(double)(1 << CDP) + 1.5*ldexp(1.0, 1 - configPARK_CORDIC_ITERATIONS);
+			Fixed alpha = S::FromDouble(0.7), beta = S::FromDouble(-1.3);
+			for(int i = 0; i < configPARK_LUT_SIZE; i += 7)
+			{
+				Fixed theta = S::FromDouble(i + 0.25);
+				Rotation<Fixed> rotation = FixedTransformer::CalcRotation(theta);
+
+				Dq<Fixed> direct = FixedTransformer::Forward(alpha, beta, theta);
+				Dq<Fixed> viaSinCos = FixedTransformer::Forward(alpha, beta, rotation);
+				CHECK_CLOSE(S::ToDouble(viaSinCos.d), S::ToDouble(direct.d), tolerance);
+				CHECK_CLOSE(S::ToDouble(viaSinCos.q), S::ToDouble(direct.q), tolerance);
+
+				AlphaBeta<Fixed> ab = FixedTransformer::Inverse(direct.d, direct.q, theta);
+				AlphaBeta<Fixed> abViaSinCos = FixedTransformer::Inverse(direct.d, direct.q, rotation);
+				CHECK_CLOSE(S::ToDouble(abViaSinCos.alpha), S::ToDouble(ab.alpha), tolerance);
+				CHECK_CLOSE(S::ToDouble(abViaSinCos.beta), S::ToDouble(ab.beta), tolerance);
+				CHECK_CLOSE(0.7, S::ToDouble(ab.alpha), tolerance);
+				CHECK_CLOSE(-1.3, S::ToDouble(ab.beta), tolerance);
+			}
+		}
+
+		TEST(LutPositionAngleToBam32IsExact)
+		{
+			// theta in LUT entries, 24.8 fixed point, 256 entries per turn
+			typedef QFixed<int32_t, 8> Fixed;
+			typedef LutPositionAngle<Fixed, 256> Angle;
+			Fixed theta;
+			theta.raw = 64 << 8;
+			CHECK_EQUAL(0x40000000u, Angle::ToBam32(theta).value);
+			theta.raw = -(64 << 8) + 1;
+			CHECK_EQUAL(0xC0000000u + (1u << 16), Angle::ToBam32(theta).value);
+		}
+
+	} // SUITE(CordicTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,250 @@
+//!
+//! @file 			DqLogTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the compressed d-q log encoder and streaming decoder.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(DqLogTests)
+	{
+		using namespace ParkTransform;
+
+		static const size_t numSamples = 10000;
+
+		//! Near-DC d and q with a little noise, like a steady state current loop
+		template <typename T>
+		static void MakeSteadyState(std::vector<T> &d, std::vector<T> &q, double scale)
+		{
+			d.resize(numSamples);
+			q.resize(numSamples);
+			uint32_t seed = 1;
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				seed = seed*1664525u + 1013904223u;
+				double noise = ((double)(seed >> 8)/(double)(1 << 24) - 0.5)*1e-4;
+				d[i] = (T)((0.01 + noise)*scale);
+				q[i] = (T)((0.75 - noise)*scale);
+			}
+		}
+
+		//! Encodes d and q into a whole log, in blocks of blockSize
+		template <typename T>
+		static std::vector<uint8_t> Encode(const DqLogEncoder &encoder, const std::vector<T> &d,
+			const std::vector<T> &q, size_t blockSize)
+		{
+			std::vector<uint8_t> log(DqLogEncoder::headerSize + DqLogEncoder::MaxBlockSize(blockSize)*(d.size()/blockSize + 1) + 1);
+			size_t size = encoder.EncodeHeader(&log[0]);
+			for(size_t start = 0; start < d.size(); start += blockSize)
+			{
+				size_t num = (d.size() - start < blockSize) ? d.size() - start : blockSize;
+				size_t blockBytes = encoder.EncodeBlock(&d[start], &q[start], num, &log[size]);
+				CHECK(blockBytes > 0);
+				size += blockBytes;
+			}
+			size += encoder.EncodeEnd(&log[size]);
+			log.resize(size);
+			return log;
+		}
+
+		//! Decodes a whole log, feeding the decoder chunkSize bytes at a time
+		template <typename T>
+		static bool Decode(const std::vector<uint8_t> &log, size_t chunkSize, std::vector<T> &d, std::vector<T> &q)
+		{
+			DqLogDecoder decoder;
+			std::vector<T> dBlock(configPARK_DQ_LOG_BLOCK_SIZE), qBlock(configPARK_DQ_LOG_BLOCK_SIZE);
+			size_t pos = 0;
+			size_t available = 0;
+			bool hasHeader = false;
+			for(;;)
+			{
+				available = (available + chunkSize < log.size()) ? available + chunkSize : log.size();
+				for(;;)
+				{
+					size_t numUsed, num;
+					DqLogStatus status = hasHeader ?
+						decoder.DecodeBlock(&log[pos], available - pos, &dBlock[0], &qBlock[0], &num, &numUsed) :
+						decoder.DecodeHeader(&log[pos], available - pos, &numUsed);
+					if(status == DqLogStatus::ERROR)
+						return false;
+					if(status == DqLogStatus::END)
+						return pos + numUsed == log.size();
+					if(status == DqLogStatus::NEED_MORE)
+					{
+						if(available == log.size())
+							return false;
+						break;
+					}
+					if(hasHeader)
+					{
+						d.insert(d.end(), dBlock.begin(), dBlock.begin() + num);
+						q.insert(q.end(), qBlock.begin(), qBlock.begin() + num);
+					}
+					hasHeader = true;
+					pos += numUsed;
+				}
+			}
+		}
+
+		TEST(DoubleRoundTripIsLossless)
+		{
+			std::vector<double> d, q, dOut, qOut;
+			MakeSteadyState(d, q, 1.0);
+			d[100] = -0.0;
+			q[200] = NAN;
+			DqLogEncoder encoder(SampleType::FLOAT64, 20000.0);
+			std::vector<uint8_t> log = Encode(encoder, d, q, 1000);
+
+			CHECK(Decode(log, 4096, dOut, qOut));
+			CHECK_EQUAL(numSamples, dOut.size());
+			// Bit for bit, including -0.0 and NaN
+			CHECK(memcmp(&d[0], &dOut[0], numSamples*sizeof(double)) == 0);
+			CHECK(memcmp(&q[0], &qOut[0], numSamples*sizeof(double)) == 0);
+		}
+
+		TEST(FixedPointCompresses)
+		{
+			const uint8_t cdp = 20;
+			std::vector<int32_t> d, q, dOut, qOut;
+			MakeSteadyState(d, q, (double)(1 << cdp));
+			DqLogEncoder encoder(SampleType::INT32, 20000.0, cdp);
+			std::vector<uint8_t> log = Encode(encoder, d, q, configPARK_DQ_LOG_BLOCK_SIZE);
+
+			// 1e-4 of noise at 2^20 is about 7 bits, so 1-2 bytes per value against 4 raw
+			CHECK(log.size() < numSamples*2*sizeof(int32_t)/2);
+
+			// Byte at a time, every NEED_MORE path gets hit
+			CHECK(Decode(log, 1, dOut, qOut));
+			CHECK(d == dOut);
+			CHECK(q == qOut);
+
+			DqLogDecoder decoder;
+			size_t numUsed;
+			CHECK(decoder.DecodeHeader(&log[0], log.size(), &numUsed) == DqLogStatus::OK);
+			CHECK(decoder.GetHeader().type == SampleType::INT32);
+			CHECK_EQUAL(cdp, decoder.GetHeader().cdp);
+			CHECK_EQUAL(20000.0, decoder.GetHeader().sampleRate);
+		}
+
+		TEST(ConstantFloatIsOneBytePerValue)
+		{
+			std::vector<float> d(numSamples, 0.1f), q(numSamples, -0.3f), dOut, qOut;
+			d[5000] = 0.2f;		// A step
+			DqLogEncoder encoder(SampleType::FLOAT32, 0.0);
+			std::vector<uint8_t> log = Encode(encoder, d, q, configPARK_DQ_LOG_BLOCK_SIZE);
+			CHECK(log.size() < numSamples*2 + 100);
+			CHECK(Decode(log, 100, dOut, qOut));
+			CHECK(d == dOut);
+			CHECK(q == qOut);
+		}
+
+		TEST(RejectsBadLogs)
+		{
+			std::vector<double> d, q, dOut, qOut;
+			MakeSteadyState(d, q, 1.0);
+			DqLogEncoder encoder(SampleType::FLOAT64, 0.0);
+			std::vector<uint8_t> log = Encode(encoder, d, q, 1000);
+
+			// Wrong type for the log
+			float f[1];
+			uint8_t block[64];
+			CHECK_EQUAL(0u, encoder.EncodeBlock(f, f, 1, block));
+			DqLogDecoder decoder;
+			size_t numUsed, num;
+			CHECK(decoder.DecodeHeader(&log[0], log.size(), &numUsed) == DqLogStatus::OK);
+			float fBlock[configPARK_DQ_LOG_BLOCK_SIZE];
+			CHECK(decoder.DecodeBlock(&log[numUsed], log.size() - numUsed, fBlock, fBlock, &num, &numUsed) == DqLogStatus::ERROR);
+
+			// Truncated
+			std::vector<uint8_t> truncated(log.begin(), log.end() - 100);
+			CHECK(!Decode(truncated, 4096, dOut, qOut));
+
+			// Corrupt payload size
+			std::vector<uint8_t> corrupt = log;
+			corrupt[DqLogEncoder::headerSize + 2] ^= 0x01;
+			CHECK(!Decode(corrupt, 4096, dOut, qOut));
+
+			// Corrupt magic
+			corrupt = log;
+			corrupt[0] = 'X';
+			CHECK(!Decode(corrupt, 4096, dOut, qOut));
+		}
+
+		TEST(DamagedBlockCanBeSkipped)
+		{
+			std::vector<int32_t> d, q;
+			MakeSteadyState(d, q, 65536.0);
+			DqLogEncoder encoder(SampleType::INT32, 0.0, 16);
+			std::vector<uint8_t> log = Encode(encoder, d, q, 1000);
+
+			// The last residual byte of the first block, past varint(1000) and the payload size
+			size_t numUsed, num;
+			DqLogDecoder decoder;
+			CHECK(decoder.DecodeHeader(&log[0], log.size(), &numUsed) == DqLogStatus::OK);
+			size_t pos = numUsed;
+			std::vector<int32_t> dBlock(configPARK_DQ_LOG_BLOCK_SIZE), qBlock(configPARK_DQ_LOG_BLOCK_SIZE);
+			CHECK(decoder.DecodeBlock(&log[pos], log.size() - pos, &dBlock[0], &qBlock[0], &num, &numUsed) == DqLogStatus::OK);
+			size_t firstBlockSize = numUsed;
+			log[pos + firstBlockSize - 1] |= 0x80;
+
+			// The payload now ends part way through a varint, but its size is known
+			CHECK(decoder.DecodeBlock(&log[pos], log.size() - pos, &dBlock[0], &qBlock[0], &num, &numUsed) == DqLogStatus::ERROR);
+			CHECK_EQUAL(firstBlockSize, numUsed);
+			CHECK_EQUAL(0u, num);
+			pos += numUsed;
+
+			// The next block decodes as normal
+			CHECK(decoder.DecodeBlock(&log[pos], log.size() - pos, &dBlock[0], &qBlock[0], &num, &numUsed) == DqLogStatus::OK);
+			CHECK_EQUAL(1000u, num);
+			CHECK_ARRAY_EQUAL(&d[1000], &dBlock[0], 1000);
+			CHECK_ARRAY_EQUAL(&q[1000], &qBlock[0], 1000);
+
+			// A damaged block header can't be skipped
+			log[pos] = 0xFF;
+			log[pos + 1] = 0xFF;
+			log[pos + 2] = 0x7F;
+			CHECK(decoder.DecodeBlock(&log[pos], log.size() - pos, &dBlock[0], &qBlock[0], &num, &numUsed) == DqLogStatus::ERROR);
+			CHECK_EQUAL(0u, numUsed);
+		}
+
+		TEST(RejectsOverlongVarint)
+		{
+			DqLogEncoder encoder(SampleType::FLOAT64, 0.0);
+			uint8_t log[64];
+			size_t size = encoder.EncodeHeader(log);
+			DqLogDecoder decoder;
+			size_t numUsed, num;
+			CHECK(decoder.DecodeHeader(log, size, &numUsed) == DqLogStatus::OK);
+
+			// One sample with d = the largest residual, 2^64 - 1: nine 0xFF bytes then 0x01
+			uint8_t *block = &log[size];
+			block[0] = 1;
+			uint8_t *payload = &block[5];
+			for(int i = 0; i < 9; i++)
+				payload[i] = 0xFF;
+			payload[9] = 0x01;
+			payload[10] = 0x00;
+			block[1] = 11;
+			block[2] = block[3] = block[4] = 0;
+			double d, q;
+			CHECK(decoder.DecodeBlock(block, 16, &d, &q, &num, &numUsed) == DqLogStatus::OK);
+
+			// A 10th byte of 2 would be bit 64
+			payload[9] = 0x02;
+			CHECK(decoder.DecodeBlock(block, 16, &d, &q, &num, &numUsed) == DqLogStatus::ERROR);
+		}
+	}
+
+} // namespace ParkTransformTest
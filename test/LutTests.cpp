@@ -0,0 +1,107 @@
+//!
+//! @file 			LutTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the compile-time sine and cosine LUT's.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(LutTests)
+	{
+		typedef ParkTransform::SinCosLut<255, 8> Lut255;
+		typedef ParkTransform::SinCosLut<1024, 16> Lut1024;
+		typedef ParkTransform::SinCosLut<256, 8, ParkTransform::LutStorage::QUARTER_WAVE> QuarterLut256;
+		typedef ParkTransform::SinCosLut<1000, 14, ParkTransform::LutStorage::QUARTER_WAVE> QuarterLut1000;
+
+		// The tables must be usable in constant expressions, i.e. built by the compiler
+		static_assert(Lut255::Sin(0) == 0, "sin(0) should be 0");
+		static_assert(Lut255::Cos(0) == (1 << 8), "cos(0) should be 1.0");
+		static_assert(Lut1024::Sin(256) == (1 << 16), "sin(pi/2) should be 1.0");
+		static_assert(QuarterLut256::Cos(128) == -(1 << 8), "cos(pi) should be -1.0");
+		static_assert(QuarterLut256::numBytes*8 == ParkTransform::SinCosLut<256, 8>::numBytes + 8*sizeof(int32_t),
+			"Quarter-wave table should be 8x smaller (plus the extra end point)");
+
+		template <class Lut>
+		static void CheckAgainstLibm(double fracBits)
+		{
+			double scale = pow(2.0, fracBits);
+			for(uint32_t i = 0; i < Lut::numEntries; i++)
+			{
+				double angle = 2.0*M_PI*(double)i/(double)Lut::numEntries;
+				// Allow for the entry being rounded, plus a tiny bit for a rounding tie
+				CHECK_CLOSE(sin(angle)*scale, (double)Lut::Sin(i), 0.5001);
+				CHECK_CLOSE(cos(angle)*scale, (double)Lut::Cos(i), 0.5001);
+			}
+		}
+
+		TEST(Lut255MatchesLibm)
+		{
+			CheckAgainstLibm<Lut255>(8);
+		}
+
+		TEST(Lut1024MatchesLibm)
+		{
+			CheckAgainstLibm<Lut1024>(16);
+		}
+
+		TEST(QuarterWaveMatchesLibm)
+		{
+			CheckAgainstLibm<QuarterLut256>(8);
+			CheckAgainstLibm<QuarterLut1000>(14);
+		}
+
+		TEST(QuarterWaveMatchesFullWave)
+		{
+			typedef ParkTransform::SinCosLut<1000, 14> FullLut1000;
+			for(uint32_t i = 0; i < 1000; i++)
+			{
+				// Same angles, may differ by 1 LSB only where rounding ties
+				CHECK_CLOSE(FullLut1000::Sin(i), QuarterLut1000::Sin(i), 1);
+				CHECK_CLOSE(FullLut1000::Cos(i), QuarterLut1000::Cos(i), 1);
+			}
+		}
+
+		template <ParkTransform::LutInterpolation interpolation>
+		static double MaxLookupError()
+		{
+			typedef ParkTransform::SinCosLut<256, 16, ParkTransform::LutStorage::QUARTER_WAVE> Lut;
+			const uint8_t posFracBits = 8;
+
+			double maxError = 0.0;
+			// Two full turns, both signs, to check wrapping
+			for(int32_t position = -(256 << posFracBits); position < (256 << posFracBits); position += 7)
+			{
+				int32_t sinRaw, cosRaw;
+				ParkTransform::LutSinCos<Lut, posFracBits, interpolation>(position, &sinRaw, &cosRaw);
+
+				double angle = 2.0*M_PI*(double)position/(double)(256 << posFracBits);
+				maxError = fmax(maxError, fabs(sin(angle) - sinRaw/65536.0));
+				maxError = fmax(maxError, fabs(cos(angle) - cosRaw/65536.0));
+			}
+			return maxError;
+		}
+
+		TEST(TruncatedLookupError)
+		{
+			double maxError = MaxLookupError<ParkTransform::LutInterpolation::NONE>();
+			CHECK(maxError < 2.0*M_PI/256.0);
+			CHECK(maxError > 0.01);
+		}
+
+		TEST(LinearInterpolationError)
+		{
+			// Theoretical bound is (2*pi/256)^2/8 = 7.5e-5, plus the 2^-16 table resolution
+			CHECK(MaxLookupError<ParkTransform::LutInterpolation::LINEAR>() < 1e-4);
+		}
+
+	} // SUITE(LutTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,88 @@
+//!
+//! @file 			ParallelTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the work-stealing pool and the multi-threaded batch transforms.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <atomic>
+#include <math.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(ParallelTests)
+	{
+		using namespace ParkTransform;
+
+		static const uint32_t numChunks = 1001;
+		static std::atomic<int> _chunkRuns[numChunks];
+
+		static void CountChunk(void *, uint32_t chunkIndex)
+		{
+			// Uneven costs, so the threads steal from each other
+			if(chunkIndex % 7 == 0)
+				std::this_thread::yield();
+			_chunkRuns[chunkIndex]++;
+		}
+
+		TEST(EveryChunkRunsOnce)
+		{
+			const unsigned numThreads[] = { 1, 3, 8 };
+			for(size_t k = 0; k < sizeof(numThreads)/sizeof(numThreads[0]); k++)
+			{
+				WorkStealingPool pool(numThreads[k]);
+				CHECK_EQUAL(numThreads[k], pool.GetNumThreads());
+				for(int run = 0; run < 3; run++)
+				{
+					for(uint32_t i = 0; i < numChunks; i++)
+						_chunkRuns[i] = 0;
+					pool.Run(CountChunk, NULL, numChunks);
+					for(uint32_t i = 0; i < numChunks; i++)
+						CHECK_EQUAL(1, _chunkRuns[i].load());
+				}
+				pool.Run(CountChunk, NULL, 0);
+			}
+		}
+
+		TEST(OutputIndependentOfThreadCount)
+		{
+			// Not a multiple of the chunk size, so the last chunk is partial
+			const size_t numSamples = 10*configPARK_PARALLEL_CHUNK_SIZE + 123;
+			std::vector<double> alpha(numSamples), beta(numSamples), theta(numSamples);
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				alpha[i] = cos(0.001*i);
+				beta[i] = sin(0.0013*i);
+				theta[i] = 0.01*i - 100.0;
+			}
+
+			std::vector<double> dRef(numSamples), qRef(numSamples);
+			Transformer().ForwardBatch(&alpha[0], &beta[0], &theta[0], &dRef[0], &qRef[0], numSamples);
+
+			const unsigned numThreads[] = { 1, 2, 5 };
+			for(size_t k = 0; k < sizeof(numThreads)/sizeof(numThreads[0]); k++)
+			{
+				ParallelTransformer transformer(numThreads[k]);
+				std::vector<double> d(numSamples), q(numSamples);
+				transformer.ForwardBatch(&alpha[0], &beta[0], &theta[0], &d[0], &q[0], numSamples);
+				CHECK(memcmp(&dRef[0], &d[0], numSamples*sizeof(double)) == 0);
+				CHECK(memcmp(&qRef[0], &q[0], numSamples*sizeof(double)) == 0);
+
+				// Back again, in place
+				transformer.InverseBatch(&d[0], &q[0], &theta[0], &d[0], &q[0], numSamples);
+				CHECK_CLOSE(alpha[numSamples - 1], d[numSamples - 1], 1e-12);
+				CHECK_CLOSE(beta[numSamples/2], q[numSamples/2], 1e-12);
+			}
+		}
+
+	} // SUITE(ParallelTests)
+} // namespace ParkTransformTest
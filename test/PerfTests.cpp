@@ -0,0 +1,401 @@
+//!
+//! @file 			PerfTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Performance regression tests, one per transform path.
+//! @details
+//!					See README.rst in root dir for more info.
+//!					Each test runs a large batch under UNITTEST_TIME_CONSTRAINT, with the limit
+//!					taken from the ns/sample baseline in test/PerfBaseline.txt times its slack.
+//!					Batch paths run, and have a baseline, on each instruction set the host
+//!					supports (capped with Simd::SetMaxIsa()), and every limit is scaled by a
+//!					reference loop timed in the same run, so slower hosts get longer limits. Run
+//!					with PARK_PERF_CALIBRATE=1 (or 'make perfBaseline') on a quiet machine to
+//!					re-measure the baseline. A path with no baseline fails.
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+#include "../lib/UnitTest++/src/TimeConstraint.h"
+
+namespace ParkTransformTest
+{
+	SUITE(PerfTests)
+	{
+		using namespace ParkTransform;
+
+		// The Makefile passes the absolute path, so the tests can be run from any directory
+		#ifndef PARK_PERF_BASELINE_PATH
+			#define PARK_PERF_BASELINE_PATH "test/PerfBaseline.txt"
+		#endif
+
+		static const char *baselinePath = PARK_PERF_BASELINE_PATH;
+
+		//! Paths that don't use the SIMD kernels share one baseline across instruction sets
+		static const char *anyIsa = "ANY";
+
+		volatile double sink;
+
+		static double NowNs()
+		{
+			struct timespec ts;
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			return (double)ts.tv_sec*1e9 + (double)ts.tv_nsec;
+		}
+
+		//! ns per iteration of a fixed scalar loop, best of several. The ratio of this to the
+		//! value saved with the baseline scales every limit, so a slower host gets longer limits.
+		static double MeasureReferenceNs()
+		{
+			const int numIters = 1 << 20;
+			double bestNs = HUGE_VAL;
+			for(int rep = 0; rep < 5; rep++)
+			{
+				double start = NowNs();
+				double x = 0.5;
+				for(int i = 0; i < numIters; i++)
+					x = x*0.999 + sin(x);
+				sink = x;
+				bestNs = fmin(bestNs, (NowNs() - start)/numIters);
+			}
+			return bestNs;
+		}
+
+		//! ns/sample per path and instruction set, loaded from (and in calibration mode saved to)
+		//! baselinePath
+		class PerfBaseline
+		{
+		public:
+			PerfBaseline() :
+				_slack(3.0),
+				_referenceNs(0.0),
+				_scale(1.0),
+				_loaded(false),
+				_calibrating(getenv("PARK_PERF_CALIBRATE") != NULL)
+			{
+				double measuredReferenceNs = MeasureReferenceNs();
+
+				FILE *file = fopen(baselinePath, "r");
+				if(file)
+				{
+					_loaded = true;
+					char line[128];
+					while(fgets(line, sizeof(line), file))
+					{
+						char name[64], isa[16];
+						double value;
+						if(line[0] == '#')
+							continue;
+						if(sscanf(line, "%63s %15s %lf", name, isa, &value) == 3)
+							Set(name, isa, value);
+						else if(sscanf(line, "%63s %lf", name, &value) == 2 && !strcmp(name, "slack"))
+							_slack = value;
+						else if(sscanf(line, "%63s %lf", name, &value) == 2 && !strcmp(name, "reference"))
+							_referenceNs = value;
+					}
+					fclose(file);
+				}
+
+				if(_calibrating)
+					_referenceNs = measuredReferenceNs;
+				else if(_referenceNs > 0.0)
+					_scale = measuredReferenceNs/_referenceNs;
+			}
+
+			//! False if baselinePath couldn't be read
+			bool IsLoaded() const { return _loaded; }
+
+			bool IsCalibrating() const { return _calibrating; }
+
+			//! Returns the time limit for numSamples samples of path name, in ms, or INT_MAX if
+			//! there is no baseline for it on isa
+			int MaxMs(const char *name, const char *isa, double numSamples) const
+			{
+				for(size_t i = 0; i < _entries.size(); i++)
+				{
+					if(_entries[i].name == name && _entries[i].isa == isa)
+						return (int)ceil(_entries[i].nsPerSample*_scale*numSamples*_slack/1e6);
+				}
+				return INT_MAX;
+			}
+
+			void Set(const char *name, const char *isa, double nsPerSample)
+			{
+				// New instruction sets go after the path's other entries, so they stay together
+				size_t insertAt = _entries.size();
+				for(size_t i = 0; i < _entries.size(); i++)
+				{
+					if(_entries[i].name == name && _entries[i].isa == isa)
+					{
+						_entries[i].nsPerSample = nsPerSample;
+						return;
+					}
+					if(_entries[i].name == name)
+						insertAt = i + 1;
+				}
+				Entry entry = { name, isa, nsPerSample };
+				_entries.insert(_entries.begin() + insertAt, entry);
+			}
+
+			void Save() const
+			{
+				FILE *file = fopen(baselinePath, "w");
+				if(!file)
+					return;
+				fprintf(file, "# Perf test baseline, ns/sample per path and instruction set (ANY if it doesn't\n");
+				fprintf(file, "# use the SIMD kernels). 'make perfBaseline' re-measures every one the host supports.\n");
+				fprintf(file, "# A test fails when it takes longer than slack*baseline, scaled by how much slower\n");
+				fprintf(file, "# the reference loop (ns/iteration) runs than it did here.\n");
+				fprintf(file, "slack %.1f\n", _slack);
+				fprintf(file, "reference %.3f\n", _referenceNs);
+				for(size_t i = 0; i < _entries.size(); i++)
+					fprintf(file, "%s %s %.3f\n", _entries[i].name.c_str(), _entries[i].isa.c_str(), _entries[i].nsPerSample);
+				fclose(file);
+			}
+
+		private:
+			struct Entry
+			{
+				std::string name;
+				std::string isa;
+				double nsPerSample;
+			};
+
+			std::vector<Entry> _entries;
+			double _slack;
+			double _referenceNs;
+			double _scale;
+			bool _loaded;
+			bool _calibrating;
+		};
+
+		static PerfBaseline &Baseline()
+		{
+			static PerfBaseline baseline;
+			return baseline;
+		}
+
+		//! Warms up run (numSamples samples), re-measures the baseline when calibrating, and
+		//! returns the time limit for one more run. isa is anyIsa for paths that don't use the
+		//! SIMD kernels. Fails the test if there is no baseline, rather than running unconstrained.
+		template <class Run>
+		static int MaxMs(const char *name, const char *isa, double numSamples, Run run)
+		{
+			run();
+			if(Baseline().IsCalibrating())
+			{
+				// Best of several, the baseline should be the uncontended speed
+				double bestNs = HUGE_VAL;
+				for(int i = 0; i < 5; i++)
+				{
+					double start = NowNs();
+					run();
+					bestNs = fmin(bestNs, NowNs() - start);
+				}
+				Baseline().Set(name, isa, bestNs/numSamples);
+				Baseline().Save();
+			}
+			int maxMs = Baseline().MaxMs(name, isa, numSamples);
+			if(maxMs == INT_MAX && Baseline().IsLoaded())
+			{
+				std::string message = std::string("No baseline for ") + name + " on " + isa +
+					" in " + baselinePath + ", run 'make perfBaseline'";
+				UnitTest::CurrentTest::Results()->OnTestFailure(*UnitTest::CurrentTest::Details(), message.c_str());
+			}
+			return maxMs;
+		}
+
+		//! The instruction sets the batch paths can run on here, narrowest first
+		static std::vector<Simd::Isa> BatchIsas()
+		{
+			std::vector<Simd::Isa> isas;
+			const Simd::Isa all[] = { Simd::Isa::SCALAR, Simd::Isa::AVX2, Simd::Isa::AVX512 };
+			for(size_t i = 0; i < sizeof(all)/sizeof(all[0]); i++)
+			{
+				if(Simd::IsSupported(all[i]))
+					isas.push_back(all[i]);
+			}
+			return isas;
+		}
+
+		//! Caps the batch paths at one instruction set while in scope
+		class MaxIsaScope
+		{
+		public:
+			MaxIsaScope(Simd::Isa isa) { Simd::SetMaxIsa(isa); }
+			~MaxIsaScope() { Simd::SetMaxIsa(Simd::Isa::AVX512); }
+		};
+
+		TEST(BaselineIsLoaded)
+		{
+			// A missing file would silently turn every limit off
+			CHECK(Baseline().IsLoaded() || Baseline().IsCalibrating());
+		}
+
+
+		static const size_t numSamples = 1 << 16;
+		static const int numReps = 64;
+
+		//! Inputs and outputs for the batch paths
+		struct Arrays
+		{
+			Arrays() : a(numSamples), b(numSamples), c(numSamples), theta(numSamples), x(numSamples), y(numSamples), z(numSamples)
+			{
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					a[i] = cos(0.01*i);
+					b[i] = cos(0.01*i - 2.094);
+					c[i] = -a[i] - b[i];
+					theta[i] = 0.013*i;
+				}
+			}
+
+			std::vector<double> a, b, c, theta, x, y, z;
+		};
+
+		TEST(DoubleForward)
+		{
+			Transformer transformer;
+			const size_t numCalls = 1 << 22;
+			auto run = [&]()
+			{
+				double acc = 0.0;
+				for(size_t i = 0; i < numCalls; i++)
+				{
+					double d, q;
+					transformer.Forward(0.5, -0.25, 0.013*(double)(i & 0xFFFF), &d, &q);
+					acc += d + q;
+				}
+				sink = acc;
+			};
+			const int maxMs = MaxMs("DoubleForward", anyIsa, numCalls, run);
+			UNITTEST_TIME_CONSTRAINT(maxMs);
+			run();
+		}
+
+		TEST(Q31LutForward)
+		{
+			typedef BasicTransformer<Q31, BamAngle<uint32_t>,
+				LutTrig<SinCosLut<1024, 30, LutStorage::QUARTER_WAVE>, LutInterpolation::LINEAR> > Q31Transformer;
+			typedef ScalarTraits<Q31> S;
+			const size_t numCalls = 1 << 22;
+			auto run = [&]()
+			{
+				int32_t acc = 0;
+				for(size_t i = 0; i < numCalls; i++)
+				{
+					Q31 d, q;
+					Q31Transformer::Forward(S::FromDouble(0.5), S::FromDouble(-0.25), Bam32((uint32_t)(i*2654435761u)), &d, &q);
+					acc += d.raw ^ q.raw;
+				}
+				sink = acc;
+			};
+			const int maxMs = MaxMs("Q31LutForward", anyIsa, numCalls, run);
+			UNITTEST_TIME_CONSTRAINT(maxMs);
+			run();
+		}
+
+		TEST(ForwardBatch)
+		{
+			Transformer transformer;
+			Arrays arrays;
+			auto run = [&]()
+			{
+				for(int rep = 0; rep < numReps; rep++)
+					transformer.ForwardBatch(&arrays.a[0], &arrays.b[0], &arrays.theta[0], &arrays.x[0], &arrays.y[0], numSamples);
+			};
+			const std::vector<Simd::Isa> isas = BatchIsas();
+			for(size_t i = 0; i < isas.size(); i++)
+			{
+				MaxIsaScope isaScope(isas[i]);
+				const int maxMs = MaxMs("ForwardBatch", Simd::GetIsaName(isas[i]), (double)numSamples*numReps, run);
+				UNITTEST_TIME_CONSTRAINT(maxMs);
+				run();
+			}
+		}
+
+		TEST(InverseBatch)
+		{
+			Transformer transformer;
+			Arrays arrays;
+			auto run = [&]()
+			{
+				for(int rep = 0; rep < numReps; rep++)
+					transformer.InverseBatch(&arrays.a[0], &arrays.b[0], &arrays.theta[0], &arrays.x[0], &arrays.y[0], numSamples);
+			};
+			const std::vector<Simd::Isa> isas = BatchIsas();
+			for(size_t i = 0; i < isas.size(); i++)
+			{
+				MaxIsaScope isaScope(isas[i]);
+				const int maxMs = MaxMs("InverseBatch", Simd::GetIsaName(isas[i]), (double)numSamples*numReps, run);
+				UNITTEST_TIME_CONSTRAINT(maxMs);
+				run();
+			}
+		}
+
+		TEST(ForwardFromABCBatch)
+		{
+			Transformer transformer;
+			Arrays arrays;
+			auto run = [&]()
+			{
+				for(int rep = 0; rep < numReps; rep++)
+					transformer.ForwardFromABCBatch(&arrays.a[0], &arrays.b[0], &arrays.c[0], &arrays.theta[0],
+						&arrays.x[0], &arrays.y[0], &arrays.z[0], numSamples);
+			};
+			const std::vector<Simd::Isa> isas = BatchIsas();
+			for(size_t i = 0; i < isas.size(); i++)
+			{
+				MaxIsaScope isaScope(isas[i]);
+				const int maxMs = MaxMs("ForwardFromABCBatch", Simd::GetIsaName(isas[i]), (double)numSamples*numReps, run);
+				UNITTEST_TIME_CONSTRAINT(maxMs);
+				run();
+			}
+		}
+
+		TEST(InverseSvpwmBatch)
+		{
+			Transformer transformer;
+			Arrays arrays;
+			auto run = [&]()
+			{
+				for(int rep = 0; rep < numReps; rep++)
+					transformer.InverseSvpwmBatch(&arrays.a[0], &arrays.b[0], &arrays.theta[0],
+						&arrays.x[0], &arrays.y[0], &arrays.z[0], numSamples);
+			};
+			const std::vector<Simd::Isa> isas = BatchIsas();
+			for(size_t i = 0; i < isas.size(); i++)
+			{
+				MaxIsaScope isaScope(isas[i]);
+				const int maxMs = MaxMs("InverseSvpwmBatch", Simd::GetIsaName(isas[i]), (double)numSamples*numReps, run);
+				UNITTEST_TIME_CONSTRAINT(maxMs);
+				run();
+			}
+		}
+
+		TEST(ForwardStream)
+		{
+			Transformer transformer;
+			Arrays arrays;
+			auto run = [&]()
+			{
+				for(int rep = 0; rep < numReps; rep++)
+					transformer.ForwardStream(&arrays.a[0], &arrays.b[0], 0.1, 0.013, &arrays.x[0], &arrays.y[0], numSamples);
+			};
+			const int maxMs = MaxMs("ForwardStream", anyIsa, (double)numSamples*numReps, run);
+			UNITTEST_TIME_CONSTRAINT(maxMs);
+			run();
+		}
+
+	} // SUITE(PerfTests)
+} // namespace ParkTransformTest
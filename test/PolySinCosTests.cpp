@@ -0,0 +1,104 @@
+//!
+//! @file 			PolySinCosTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Accuracy of each PolySinCos() tier, scalar and batch.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(PolySinCosTests)
+	{
+		using namespace ParkTransform;
+		using ParkTransform::Simd::Isa;
+
+		//! Max error against libm, over angles up to +-50 turns including the quadrant boundaries
+		template <PolyAccuracy accuracy, typename T>
+		static double MaxError()
+		{
+			double maxError = 0.0;
+			for(int i = -20000; i <= 20000; i++)
+			{
+				T theta = (T)(i*0.0157079632679 + (i % 7)*1e-3);
+				T sinTheta, cosTheta;
+				PolySinCos<accuracy>(theta, &sinTheta, &cosTheta);
+				maxError = fmax(maxError, fabs(sin((double)theta) - sinTheta));
+				maxError = fmax(maxError, fabs(cos((double)theta) - cosTheta));
+			}
+			return maxError;
+		}
+
+		TEST(ErrorBoundsPerTier)
+		{
+			// The bounds documented in PolySinCos.hpp
+			CHECK((MaxError<PolyAccuracy::LOW, double>()) < 1.6e-4);
+			CHECK((MaxError<PolyAccuracy::MEDIUM, double>()) < 3e-8);
+			CHECK((MaxError<PolyAccuracy::FULL, double>()) < 2e-16);
+			CHECK((MaxError<PolyAccuracy::LOW, float>()) < 1.6e-4);
+			CHECK((MaxError<PolyAccuracy::MEDIUM, float>()) < 1.5e-7);
+			CHECK((MaxError<PolyAccuracy::FULL, float>()) < 1e-7);
+		}
+
+		TEST(LargeAnglesFallBackToLibm)
+		{
+			double sinTheta, cosTheta;
+			PolySinCos<PolyAccuracy::LOW>(1e9, &sinTheta, &cosTheta);
+			CHECK_CLOSE(sin(1e9), sinTheta, 1e-12);
+			CHECK_CLOSE(cos(1e9), cosTheta, 1e-12);
+		}
+
+		TEST(BatchKernelsMatchScalarTier)
+		{
+			const size_t numSamples = 99;
+			double alpha[numSamples], beta[numSamples], theta[numSamples];
+			double d[numSamples], q[numSamples];
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				alpha[i] = 0.9*cos(0.37*i);
+				beta[i] = 0.9*sin(0.23*i);
+				theta[i] = -20.0 + 0.41*i;
+			}
+
+			const Isa isas[] = { Isa::SCALAR, Isa::AVX2, Isa::AVX512 };
+			for(size_t k = 0; k < sizeof(isas)/sizeof(isas[0]); k++)
+			{
+				Simd::ForwardBatch(isas[k], PolyAccuracy::MEDIUM, alpha, beta, theta, d, q, numSamples);
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					double dRef, qRef;
+					Transformer().Forward<PolyAccuracy::MEDIUM>(alpha[i], beta[i], theta[i], &dRef, &qRef);
+					CHECK_CLOSE(dRef, d[i], 1e-14);
+					CHECK_CLOSE(qRef, q[i], 1e-14);
+				}
+			}
+		}
+
+		TEST(TierPerCallSite)
+		{
+			Transformer transformer;
+			double dFull, qFull, dLow, qLow, alpha, beta;
+			transformer.Forward(0.4, -0.3, 2.5, &dFull, &qFull);
+			transformer.Forward<PolyAccuracy::LOW>(0.4, -0.3, 2.5, &dLow, &qLow);
+			CHECK_CLOSE(dFull, dLow, 2*1.6e-4);
+			CHECK_CLOSE(qFull, qLow, 2*1.6e-4);
+
+			transformer.Inverse<PolyAccuracy::MEDIUM>(dFull, qFull, 2.5, &alpha, &beta);
+			CHECK_CLOSE(0.4, alpha, 1e-7);
+			CHECK_CLOSE(-0.3, beta, 1e-7);
+
+			float alphaF[3] = { 0.1f, 0.2f, 0.3f }, betaF[3] = { 0.3f, 0.2f, 0.1f };
+			float thetaF[3] = { 0.0f, 1.0f, 2.0f }, dF[3], qF[3];
+			transformer.ForwardBatch<PolyAccuracy::LOW>(alphaF, betaF, thetaF, dF, qF, 3);
+			CHECK_CLOSE(0.2*cos(1.0) + 0.2*sin(1.0), dF[1], 1e-3);
+		}
+
+	} // SUITE(PolySinCosTests)
+} // namespace ParkTransformTest
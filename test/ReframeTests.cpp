@@ -0,0 +1,132 @@
+//!
+//! @file 			ReframeTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for Reframe(), the single rotation from one d-q frame to another.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(ReframeTests)
+	{
+		using namespace ParkTransform;
+
+		const size_t numSamples = 1003;		// Not a multiple of any vector width, to exercise the tail
+
+		//! Inverse() at thetaFrom, then Forward() at thetaTo, as done before Reframe() existed
+		static void Reference(double d, double q, double thetaFrom, double thetaTo, double *dOut, double *qOut)
+		{
+			Transformer transformer;
+			double alpha, beta;
+			transformer.Inverse(d, q, thetaFrom, &alpha, &beta);
+			transformer.Forward(alpha, beta, thetaTo, dOut, qOut);
+		}
+
+		TEST(MatchesInverseThenForward)
+		{
+			Transformer transformer;
+			for(int i = 0; i < 100; i++)
+			{
+				double d = 0.3 + 0.01*i, q = -0.7 + 0.013*i;
+				double thetaFrom = -7.0 + 0.17*i, thetaTo = 11.0 - 0.23*i;
+				double dRef, qRef;
+				Reference(d, q, thetaFrom, thetaTo, &dRef, &qRef);
+
+				Dq<double> dq = transformer.Reframe(d, q, thetaFrom, thetaTo);
+				CHECK_CLOSE(dRef, dq.d, 1e-12);
+				CHECK_CLOSE(qRef, dq.q, 1e-12);
+			}
+
+			// The same frame is a no-op, and a quarter turn on moves d into -q
+			Dq<double> dq = transformer.Reframe(0.5, 0.25, 1.0, 1.0);
+			CHECK_CLOSE(0.5, dq.d, 1e-15);
+			CHECK_CLOSE(0.25, dq.q, 1e-15);
+			dq = transformer.Reframe(1.0, 0.0, 0.0, M_PI/2.0);
+			CHECK_CLOSE(0.0, dq.d, 1e-15);
+			CHECK_CLOSE(-1.0, dq.q, 1e-15);
+		}
+
+		TEST(RelativeRotation)
+		{
+			typedef BasicTransformer<double> T;
+			Rotation<double> relative = T::RelativeRotation(T::CalcRotation(0.4), T::CalcRotation(2.9));
+			CHECK_CLOSE(cos(2.5), relative.cosTheta, 1e-15);
+			CHECK_CLOSE(sin(2.5), relative.sinTheta, 1e-15);
+		}
+
+		TEST(BatchMatchesScalar)
+		{
+			std::vector<double> d(numSamples), q(numSamples), thetaFrom(numSamples), thetaTo(numSamples);
+			std::vector<double> dOut(numSamples), qOut(numSamples);
+			std::vector<float> dF(numSamples), qF(numSamples), thetaFromF(numSamples), thetaToF(numSamples);
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				d[i] = sin(0.1*i);
+				q[i] = cos(0.07*i);
+				thetaFrom[i] = 0.05*i;
+				thetaTo[i] = 3.0*thetaFrom[i] + 0.5;	// e.g. a different pole pair count and an offset
+				dF[i] = (float)d[i];
+				qF[i] = (float)q[i];
+				thetaFromF[i] = (float)thetaFrom[i];
+				thetaToF[i] = (float)thetaTo[i];
+			}
+
+			Transformer transformer;
+			transformer.ReframeBatch(&d[0], &q[0], &thetaFrom[0], &thetaTo[0], &dOut[0], &qOut[0], numSamples);
+			// In place
+			transformer.ReframeBatch(&dF[0], &qF[0], &thetaFromF[0], &thetaToF[0], &dF[0], &qF[0], numSamples);
+
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				double dRef, qRef;
+				Reference(d[i], q[i], thetaFrom[i], thetaTo[i], &dRef, &qRef);
+				CHECK_CLOSE(dRef, dOut[i], 1e-11);
+				CHECK_CLOSE(qRef, qOut[i], 1e-11);
+				// float angles up to ~150 rad, so about 1e-5 of angle error
+				CHECK_CLOSE(dRef, dF[i], 1e-4);
+				CHECK_CLOSE(qRef, qF[i], 1e-4);
+			}
+		}
+
+		TEST(BinaryAngleWraps)
+		{
+			typedef BasicTransformer<double, BamAngle<uint32_t> > BamTransformer;
+			// 0.9 of a turn to 0.1 of a turn is 0.2 of a turn on
+			Bam32 from = Bam32::FromRadians(0.9*2.0*M_PI);
+			Bam32 to = Bam32::FromRadians(0.1*2.0*M_PI);
+			Dq<double> dq = BamTransformer::Reframe(1.0, 0.0, from, to);
+			CHECK_CLOSE(cos(0.4*M_PI), dq.d, 1e-8);		// Bam32 resolution
+			CHECK_CLOSE(-sin(0.4*M_PI), dq.q, 1e-8);
+		}
+
+		TEST(LutPositionAngleWraps)
+		{
+			typedef QFixed<int32_t, 16> Fixed;
+			typedef LutPositionAngle<Fixed, 1024> Angle;
+			typedef BasicTransformer<Fixed, Angle, LutTrig<SinCosLut<1024, 16> > > FixedTransformer;
+			typedef ScalarTraits<Fixed> S;
+
+			// Entry 1000 to entry 24 is 48 entries on, not -976 (which would saturate a narrower type)
+			Fixed from = S::FromDouble(1000.0), to = S::FromDouble(24.0);
+			CHECK_EQUAL(48 << 16, Angle::Difference(to, from).raw);
+
+			Fixed alpha, beta, dRef, qRef;
+			FixedTransformer::Inverse(S::FromDouble(0.5), S::FromDouble(-0.25), from, &alpha, &beta);
+			FixedTransformer::Forward(alpha, beta, to, &dRef, &qRef);
+
+			Dq<Fixed> dq = FixedTransformer::Reframe(S::FromDouble(0.5), S::FromDouble(-0.25), from, to);
+			CHECK_CLOSE(S::ToDouble(dRef), S::ToDouble(dq.d), 1e-4);
+			CHECK_CLOSE(S::ToDouble(qRef), S::ToDouble(dq.q), 1e-4);
+		}
+	}
+
+} // namespace ParkTransformTest
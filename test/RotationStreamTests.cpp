@@ -0,0 +1,82 @@
+//!
+//! @file 			RotationStreamTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Checks the phasor recurrence stays within its documented error bounds.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(RotationStreamTests)
+	{
+		using namespace ParkTransform;
+
+		//! Max error of numSamples rotations against cos/sin of the exact angle (in long double)
+		template <typename T>
+		static double MaxError(double theta0, double deltaTheta, uint32_t resyncInterval, long numSamples)
+		{
+			RotationStream<T> stream(theta0, deltaTheta, resyncInterval);
+			double maxError = 0.0;
+			for(long i = 0; i < numSamples; i++)
+			{
+				long double theta = theta0 + (long double)i*deltaTheta;
+				maxError = fmax(maxError, fabs((double)(stream.Get().cosTheta - cosl(theta))));
+				maxError = fmax(maxError, fabs((double)(stream.Get().sinTheta - sinl(theta))));
+				stream.Next();
+			}
+			return maxError;
+		}
+
+		TEST(DoubleWithinBound)
+		{
+			// Slow and fast (several radians per sample) streams, long enough for many re-seeds
+			CHECK(MaxError<double>(0.3, 1e-4, 1024, 200000) < 2e-16*1024);
+			CHECK(MaxError<double>(-2.0, 0.7, 1024, 200000) < 2e-16*1024);
+			CHECK(MaxError<double>(1.0, -3.0, 64, 200000) < 2e-16*1024);
+		}
+
+		TEST(FloatWithinBound)
+		{
+			CHECK(MaxError<float>(0.3, 1e-2, 64, 100000) < 6e-8*64);
+			CHECK(MaxError<float>(0.3, 0.7, 16, 100000) < 6e-8*16);
+		}
+
+		TEST(ForwardStreamMatchesForward)
+		{
+			const size_t numSamples = 5000;
+			static double alpha[numSamples], beta[numSamples], d[numSamples], q[numSamples];
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				alpha[i] = cos(0.37*i);
+				beta[i] = 0.5*sin(0.11*i);
+			}
+
+			Transformer transformer;
+			transformer.ForwardStream(alpha, beta, 0.1, 0.05, d, q, numSamples);
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				double refD, refQ;
+				transformer.Forward(alpha[i], beta[i], 0.1 + 0.05*i, &refD, &refQ);
+				CHECK_CLOSE(refD, d[i], 1e-12);
+				CHECK_CLOSE(refQ, q[i], 1e-12);
+			}
+
+			// And back again, in place
+			transformer.InverseStream(d, q, 0.1, 0.05, d, q, numSamples);
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				CHECK_CLOSE(alpha[i], d[i], 1e-12);
+				CHECK_CLOSE(beta[i], q[i], 1e-12);
+			}
+		}
+
+	} // SUITE(RotationStreamTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,118 @@
+//!
+//! @file 			RotationTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the precomputed rotation overloads.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(RotationTests)
+	{
+
+		TEST(RotationMatchesThetaOverloads)
+		{
+			ParkTransform::Transformer parkTransformer;
+
+			for(int i = -50; i <= 50; i++)
+			{
+				double theta = 0.13*i;
+				ParkTransform::Rotation<double> rotation = parkTransformer.CalcRotation(theta);
+
+				double d1, q1, d2, q2;
+				parkTransformer.Forward(0.7, -1.3, theta, &d1, &q1);
+				parkTransformer.Forward(0.7, -1.3, rotation, &d2, &q2);
+				CHECK_EQUAL(d1, d2);
+				CHECK_EQUAL(q1, q2);
+
+				double alpha1, beta1, alpha2, beta2;
+				parkTransformer.Inverse(d1, q1, theta, &alpha1, &beta1);
+				parkTransformer.Inverse(d1, q1, rotation, &alpha2, &beta2);
+				CHECK_EQUAL(alpha1, alpha2);
+				CHECK_EQUAL(beta1, beta2);
+
+				// Round trip through the same rotation
+				CHECK_CLOSE(0.7, alpha2, 1e-12);
+				CHECK_CLOSE(-1.3, beta2, 1e-12);
+			}
+		}
+
+		TEST(FixedPointRotationRoundTrip)
+		{
+			// Same representation, LUT and lookup as the Fp::fp<CDP> overloads (theta in LUT
+			// entries), with QFixed so it runs without fixed-point-cpp
+			typedef ParkTransform::QFixed<int32_t, CDP> Fixed;
+			typedef ParkTransform::BasicTransformer<Fixed, ParkTransform::LutPositionAngle<Fixed, configPARK_LUT_SIZE>,
+				ParkTransform::LutTrig<ParkTransform::SinCosLut<configPARK_LUT_SIZE, CDP> > > FixedTransformer;
+			typedef ParkTransform::ScalarTraits<Fixed> S;
+
+			// A few LSB's of the rounded sin/cos and products
+			const double tolerance = 8.0/(double)(1 << CDP);
+			Fixed alpha = S::FromDouble(0.7), beta = S::FromDouble(-1.3);
+			for(int i = -configPARK_LUT_SIZE; i <= 2*configPARK_LUT_SIZE; i += 7)
+			{
+				Fixed theta = S::FromDouble(i + 0.25);
+				ParkTransform::Rotation<Fixed> rotation = FixedTransformer::CalcRotation(theta);
+
+				Fixed d1, q1, d2, q2;
+				FixedTransformer::Forward(alpha, beta, theta, &d1, &q1);
+				FixedTransformer::Forward(alpha, beta, rotation, &d2, &q2);
+				CHECK_EQUAL(d1.raw, d2.raw);
+				CHECK_EQUAL(q1.raw, q2.raw);
+
+				Fixed alpha2, beta2;
+				FixedTransformer::Inverse(d2, q2, rotation, &alpha2, &beta2);
+				CHECK_CLOSE(0.7, S::ToDouble(alpha2), tolerance);
+				CHECK_CLOSE(-1.3, S::ToDouble(beta2), tolerance);
+			}
+		}
+
+		#if(config_ENABLE_FIXED_POINT_FUNCTIONS == 1)
+		TEST(FixedPointTransformerRotationRoundTrip)
+		{
+			typedef ParkTransform::ScalarTraits<Fp::fp<CDP> > S;
+			ParkTransform::Transformer parkTransformer;
+
+			const double tolerance = 8.0/(double)(1 << CDP);
+			#if(configPARK_USE_CORDIC == 1)
+				// A few LSB's of rounding, plus CORDIC's angle error on a magnitude of 1.5
+				const double cordicTolerance = 4.0/(double)(1 << CDP) + 1.5*ldexp(1.0, 1 - configPARK_CORDIC_ITERATIONS);
+			#endif
+			Fp::fp<CDP> alpha = S::FromDouble(0.7), beta = S::FromDouble(-1.3);
+			for(int i = 0; i < configPARK_LUT_SIZE; i += 7)
+			{
+				Fp::fp<CDP> theta = S::FromDouble(i + 0.25);
+				ParkTransform::Rotation<Fp::fp<CDP> > rotation = parkTransformer.CalcRotation(theta);
+
+				Fp::fp<CDP> d1, q1, d2, q2;
+				parkTransformer.Forward(alpha, beta, theta, &d1, &q1);
+				parkTransformer.Forward(alpha, beta, rotation, &d2, &q2);
+				#if(configPARK_USE_CORDIC == 0)
+					// Both look up the same LUT entry
+					CHECK_EQUAL(S::Raw(d1), S::Raw(d2));
+					CHECK_EQUAL(S::Raw(q1), S::Raw(q2));
+				#else
+					// Theta is rotated in the CORDIC loop, the rotation multiplies by CORDIC's
+					// sin/cos (see Transformer::CalcRotation())
+					CHECK_CLOSE(S::ToDouble(d1), S::ToDouble(d2), cordicTolerance);
+					CHECK_CLOSE(S::ToDouble(q1), S::ToDouble(q2), cordicTolerance);
+				#endif
+
+				Fp::fp<CDP> alpha2, beta2;
+				parkTransformer.Inverse(d2, q2, rotation, &alpha2, &beta2);
+				CHECK_CLOSE(0.7, S::ToDouble(alpha2), tolerance);
+				CHECK_CLOSE(-1.3, S::ToDouble(beta2), tolerance);
+			}
+		}
+		#endif
+
+	} // SUITE(RotationTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,217 @@
+//!
+//! @file 			SampleFileTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the memory-mapped sample file reader, writer and ForwardFile().
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(SampleFileTests)
+	{
+		using namespace ParkTransform;
+
+		static const char *inPath = "/tmp/ParkTransformTest_In.pts";
+		static const char *outPath = "/tmp/ParkTransformTest_Out.pts";
+
+		static const size_t numSamples = 1000;
+
+		template <typename T>
+		static void WriteAlphaBetaTheta(SampleType type)
+		{
+			SampleFileWriter writer;
+			CHECK(writer.Create(inPath, SampleLayout::ALPHA_BETA_THETA, type, numSamples, 20000.0));
+			T *alpha = writer.GetColumn<T>(SampleColumn::ALPHA);
+			T *beta = writer.GetColumn<T>(SampleColumn::BETA);
+			T *theta = writer.GetColumn<T>(SampleColumn::THETA);
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				alpha[i] = (T)cos(0.01*(double)i);
+				beta[i] = (T)sin(0.01*(double)i);
+				theta[i] = (T)(0.01*(double)i);
+			}
+			CHECK(writer.Close());
+		}
+
+		TEST(RoundTrip)
+		{
+			WriteAlphaBetaTheta<double>(SampleType::FLOAT64);
+
+			SampleFileReader reader;
+			CHECK(reader.Open(inPath));
+			CHECK(reader.GetHeader().layout == SampleLayout::ALPHA_BETA_THETA);
+			CHECK(reader.GetHeader().type == SampleType::FLOAT64);
+			CHECK_EQUAL(numSamples, reader.GetNumSamples());
+			CHECK_EQUAL(20000.0, reader.GetHeader().sampleRate);
+
+			// Wrong type or column
+			CHECK(reader.GetColumn<float>(SampleColumn::ALPHA) == NULL);
+			CHECK(reader.GetColumn<double>(3) == NULL);
+
+			const double *theta = reader.GetColumn<double>(SampleColumn::THETA);
+			CHECK_EQUAL(0u, (uintptr_t)theta % 64);
+			CHECK_EQUAL(0.01*999.0, theta[999]);
+			CHECK_EQUAL(cos(0.05), reader.GetColumn<double>(SampleColumn::ALPHA)[5]);
+		}
+
+		TEST(ForwardFileMatchesForwardBatch)
+		{
+			WriteAlphaBetaTheta<double>(SampleType::FLOAT64);
+			CHECK(ForwardFile(inPath, outPath));
+
+			SampleFileReader in, out;
+			CHECK(in.Open(inPath));
+			CHECK(out.Open(outPath));
+			CHECK(out.GetHeader().layout == SampleLayout::DQ);
+			CHECK_EQUAL(numSamples, out.GetNumSamples());
+			CHECK_EQUAL(20000.0, out.GetHeader().sampleRate);
+
+			std::vector<double> d(numSamples), q(numSamples);
+			Transformer transformer;
+			transformer.ForwardBatch(in.GetColumn<double>(SampleColumn::ALPHA), in.GetColumn<double>(SampleColumn::BETA),
+				in.GetColumn<double>(SampleColumn::THETA), &d[0], &q[0], numSamples);
+			CHECK_ARRAY_EQUAL(&d[0], out.GetColumn<double>(SampleColumn::D), (int)numSamples);
+			CHECK_ARRAY_EQUAL(&q[0], out.GetColumn<double>(SampleColumn::Q), (int)numSamples);
+
+			// A rotating vector in phase with theta is (1, 0) in d-q
+			CHECK_CLOSE(1.0, out.GetColumn<double>(SampleColumn::D)[500], 1e-9);
+			CHECK_CLOSE(0.0, out.GetColumn<double>(SampleColumn::Q)[500], 1e-9);
+		}
+
+		TEST(ForwardFileFloat)
+		{
+			WriteAlphaBetaTheta<float>(SampleType::FLOAT32);
+			CHECK(ForwardFile(inPath, outPath));
+
+			SampleFileReader out;
+			CHECK(out.Open(outPath));
+			CHECK(out.GetHeader().type == SampleType::FLOAT32);
+			for(size_t i = 0; i < numSamples; i += 97)
+			{
+				CHECK_CLOSE(1.0f, out.GetColumn<float>(SampleColumn::D)[i], 1e-5f);
+				CHECK_CLOSE(0.0f, out.GetColumn<float>(SampleColumn::Q)[i], 1e-5f);
+			}
+		}
+
+		TEST(ForwardFileFixedPoint)
+		{
+			const uint8_t cdp = 20;
+			const double scale = (double)(1 << cdp);
+			{
+				SampleFileWriter writer;
+				CHECK(writer.Create(inPath, SampleLayout::ALPHA_BETA_THETA, SampleType::INT32, numSamples, 0.0, cdp));
+				CHECK(writer.GetColumn<double>(SampleColumn::ALPHA) == NULL);
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					writer.GetColumn<int32_t>(SampleColumn::ALPHA)[i] = (int32_t)(0.5*scale);
+					writer.GetColumn<int32_t>(SampleColumn::BETA)[i] = 0;
+					// A quarter turn back, in LUT entries
+					writer.GetColumn<int32_t>(SampleColumn::THETA)[i] = (int32_t)(-(double)configPARK_LUT_SIZE/4.0*scale);
+				}
+				CHECK(writer.Close());
+			}
+			CHECK(ForwardFile(inPath, outPath));
+
+			SampleFileReader in, out;
+			CHECK(in.Open(inPath));
+			CHECK_EQUAL((uint32_t)configPARK_LUT_SIZE, in.GetHeader().thetaPerTurn);
+			CHECK(out.Open(outPath));
+			CHECK_EQUAL(cdp, out.GetHeader().cdp);
+			CHECK_EQUAL(0u, out.GetHeader().thetaPerTurn);
+			// alpha = 0.5 at theta = -pi/2 is q = 0.5
+			CHECK_CLOSE(0.0, out.GetColumn<int32_t>(SampleColumn::D)[numSamples - 1]/scale, 1e-6);
+			CHECK_CLOSE(0.5, out.GetColumn<int32_t>(SampleColumn::Q)[numSamples - 1]/scale, 1e-6);
+		}
+
+		TEST(ForwardFileFixedPointMatchesLutTransformer)
+		{
+			// Same representation as Transformer::Forward(Fp::fp<CDP>...), which is only built
+			// with config_ENABLE_FIXED_POINT_FUNCTIONS: theta in LUT entries
+			const uint8_t cdp = 16;
+			typedef QFixed<int32_t, cdp> Fixed;
+			typedef BasicTransformer<Fixed, LutPositionAngle<Fixed, configPARK_LUT_SIZE>,
+				LutTrig<SinCosLut<configPARK_LUT_SIZE, cdp>, LutInterpolation::LINEAR> > FixedTransformer;
+			typedef ScalarTraits<Fixed> S;
+
+			{
+				SampleFileWriter writer;
+				CHECK(writer.Create(inPath, SampleLayout::ALPHA_BETA_THETA, SampleType::INT32, numSamples, 0.0, cdp));
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					writer.GetColumn<int32_t>(SampleColumn::ALPHA)[i] = S::FromDouble(0.8*cos(0.37*(double)i)).raw;
+					writer.GetColumn<int32_t>(SampleColumn::BETA)[i] = S::FromDouble(0.6*sin(0.11*(double)i)).raw;
+					// Several turns either way, with fractional entries
+					writer.GetColumn<int32_t>(SampleColumn::THETA)[i] = S::FromDouble(
+						0.73*((double)i - numSamples/2.0)).raw;
+				}
+				CHECK(writer.Close());
+			}
+			CHECK(ForwardFile(inPath, outPath));
+
+			SampleFileReader in, out;
+			CHECK(in.Open(inPath));
+			CHECK(out.Open(outPath));
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				Fixed alpha = S::FromRaw(in.GetColumn<int32_t>(SampleColumn::ALPHA)[i], cdp);
+				Fixed beta = S::FromRaw(in.GetColumn<int32_t>(SampleColumn::BETA)[i], cdp);
+				Fixed theta = S::FromRaw(in.GetColumn<int32_t>(SampleColumn::THETA)[i], cdp);
+				Fixed d, q;
+				FixedTransformer::Forward(alpha, beta, theta, &d, &q);
+
+				// ForwardFile() uses exact sin/cos, so only the LUT's interpolation error differs
+				CHECK_CLOSE(S::ToDouble(d), out.GetColumn<int32_t>(SampleColumn::D)[i]/65536.0, 2e-4);
+				CHECK_CLOSE(S::ToDouble(q), out.GetColumn<int32_t>(SampleColumn::Q)[i]/65536.0, 2e-4);
+			}
+		}
+
+		TEST(RejectsBadFiles)
+		{
+			SampleFileReader reader;
+			CHECK(!reader.Open("/tmp/ParkTransformTest_DoesNotExist.pts"));
+
+			// Truncated: the header says more samples than the file holds
+			WriteAlphaBetaTheta<double>(SampleType::FLOAT64);
+			CHECK(truncate(inPath, 64 + 3*64) == 0);
+			CHECK(!reader.Open(inPath));
+			CHECK(!reader.IsOpen());
+
+			// Wrong magic
+			FILE *file = fopen(inPath, "wb");
+			char junk[256] = "alpha,beta,theta\n";
+			fwrite(junk, 1, sizeof(junk), file);
+			fclose(file);
+			CHECK(!reader.Open(inPath));
+
+			// Writing over the input would truncate it while it is mapped
+			WriteAlphaBetaTheta<double>(SampleType::FLOAT64);
+			CHECK(!ForwardFile(inPath, inPath));
+			CHECK(reader.Open(inPath));
+			CHECK_EQUAL(numSamples, reader.GetNumSamples());
+			reader.Close();
+
+			// A d-q file can't be forward transformed
+			SampleFileWriter writer;
+			CHECK(writer.Create(inPath, SampleLayout::DQ, SampleType::FLOAT64, 10, 0.0));
+			CHECK(writer.Close());
+			CHECK(!ForwardFile(inPath, outPath));
+
+			remove(inPath);
+			remove(outPath);
+		}
+	}
+
+} // namespace ParkTransformTest
@@ -0,0 +1,128 @@
+//!
+//! @file 			SimdTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Checks every supported SIMD kernel against the scalar reference kernel.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(SimdTests)
+	{
+		using ParkTransform::Simd::Isa;
+
+		const size_t numSamples = 1003;		// Not a multiple of any vector width, to exercise the tail
+		const Isa isas[] = { Isa::SCALAR, Isa::AVX2, Isa::AVX512 };
+
+		template <typename T>
+		static void FillInputs(T *x, T *y, T *theta)
+		{
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				x[i] = (T)cos(0.37*i);
+				y[i] = (T)(1.5*sin(0.11*i));
+				// Sweep over many turns, both signs
+				theta[i] = (T)(-400.0 + 0.8*i);
+			}
+			// Out-of-range and special angles, which use the scalar fallback
+			theta[5] = (T)1e7;
+			theta[6] = (T)-3e6;
+		}
+
+		TEST(DoubleKernelsMatchScalar)
+		{
+			static double x[numSamples], y[numSamples], theta[numSamples];
+			static double refX[numSamples], refY[numSamples], outX[numSamples], outY[numSamples];
+			FillInputs(x, y, theta);
+
+			for(size_t k = 0; k < sizeof(isas)/sizeof(isas[0]); k++)
+			{
+				if(!ParkTransform::Simd::IsSupported(isas[k]))
+					continue;
+
+				ParkTransform::Simd::ForwardBatch(Isa::SCALAR, x, y, theta, refX, refY, numSamples);
+				ParkTransform::Simd::ForwardBatch(isas[k], x, y, theta, outX, outY, numSamples);
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					double tol = 1e-12*(fabs(x[i]) + fabs(y[i]));
+					CHECK_CLOSE(refX[i], outX[i], tol);
+					CHECK_CLOSE(refY[i], outY[i], tol);
+				}
+
+				ParkTransform::Simd::InverseBatch(Isa::SCALAR, x, y, theta, refX, refY, numSamples);
+				ParkTransform::Simd::InverseBatch(isas[k], x, y, theta, outX, outY, numSamples);
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					double tol = 1e-12*(fabs(x[i]) + fabs(y[i]));
+					CHECK_CLOSE(refX[i], outX[i], tol);
+					CHECK_CLOSE(refY[i], outY[i], tol);
+				}
+			}
+		}
+
+		TEST(FloatKernelsMatchDouble)
+		{
+			static float x[numSamples], y[numSamples], theta[numSamples];
+			static float outX[numSamples], outY[numSamples];
+			FillInputs(x, y, theta);
+
+			for(size_t k = 0; k < sizeof(isas)/sizeof(isas[0]); k++)
+			{
+				if(!ParkTransform::Simd::IsSupported(isas[k]))
+					continue;
+
+				ParkTransform::Simd::ForwardBatch(isas[k], x, y, theta, outX, outY, numSamples);
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					double refX = x[i]*cos((double)theta[i]) + y[i]*sin((double)theta[i]);
+					double refY = y[i]*cos((double)theta[i]) - x[i]*sin((double)theta[i]);
+					double tol = 1e-5*(fabs(x[i]) + fabs(y[i]));
+					CHECK_CLOSE(refX, outX[i], tol);
+					CHECK_CLOSE(refY, outY[i], tol);
+				}
+			}
+		}
+
+		TEST(ResultIndependentOfPosition)
+		{
+			// The same sample must give the same answer wherever it sits in the array
+			double x[20], y[20], theta[20], d[20], q[20];
+			for(size_t i = 0; i < 20; i++)
+			{
+				x[i] = 0.3;
+				y[i] = -0.9;
+				theta[i] = 2.5;
+			}
+
+			ParkTransform::Transformer parkTransformer;
+			parkTransformer.ForwardBatch(x, y, theta, d, q, 20);
+			for(size_t i = 1; i < 20; i++)
+			{
+				CHECK_EQUAL(d[0], d[i]);
+				CHECK_EQUAL(q[0], q[i]);
+			}
+		}
+
+		TEST(SetMaxIsaCapsBestIsa)
+		{
+			Isa best = ParkTransform::Simd::GetBestIsa();
+			for(size_t k = 0; k < sizeof(isas)/sizeof(isas[0]); k++)
+			{
+				ParkTransform::Simd::SetMaxIsa(isas[k]);
+				Isa expected = ((int)isas[k] < (int)best) ? isas[k] : best;
+				CHECK(ParkTransform::Simd::GetBestIsa() == expected);
+			}
+			ParkTransform::Simd::SetMaxIsa(Isa::AVX512);
+			CHECK(ParkTransform::Simd::GetBestIsa() == best);
+		}
+
+	} // SUITE(SimdTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,141 @@
+//!
+//! @file 			StageTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the SPSC ring and the ForwardStage, including under contention.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+#include <thread>
+#include <vector>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(StageTests)
+	{
+		using namespace ParkTransform;
+
+		TEST(PeekStopsAtTheWrap)
+		{
+			SpscRing<int, 8> ring;
+			const int *items = NULL;
+			for(int i = 0; i < 6; i++)
+				CHECK(ring.TryPush(i));
+			CHECK_EQUAL(6u, ring.Peek(&items));
+			ring.Consume(5);
+			for(int i = 6; i < 13; i++)
+				CHECK(ring.TryPush(i));
+			CHECK(!ring.TryPush(13));		// Full
+			CHECK_EQUAL(8u, ring.Size());
+
+			CHECK_EQUAL(3u, ring.Peek(&items));		// 5, 6, 7, up to the end of the storage
+			CHECK_EQUAL(5, items[0]);
+			ring.Consume(3);
+			CHECK_EQUAL(5u, ring.Peek(&items));
+			CHECK_EQUAL(8, items[0]);
+		}
+
+		TEST(RingStress)
+		{
+			// A small ring, so the producer and consumer keep meeting at both ends
+			static SpscRing<uint64_t, 64> ring;
+			const uint64_t numItems = 1000000;
+
+			std::thread producer([&]()
+			{
+				for(uint64_t i = 0; i < numItems; i++)
+				{
+					while(!ring.TryPush(i))
+						std::this_thread::yield();
+				}
+			});
+
+			uint64_t expected = 0;
+			bool inOrder = true;
+			while(expected < numItems)
+			{
+				// Alternate between single pops and whole spans
+				const uint64_t *items;
+				uint32_t num = ring.Peek(&items);
+				if(num == 0)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+				if(expected & 1)
+				{
+					uint64_t item;
+					ring.TryPop(&item);
+					inOrder &= (item == expected++);
+				}
+				else
+				{
+					for(uint32_t i = 0; i < num; i++)
+						inOrder &= (items[i] == expected++);
+					ring.Consume(num);
+				}
+			}
+			producer.join();
+
+			CHECK(inOrder);
+			CHECK_EQUAL(0u, ring.Size());
+		}
+
+		TEST(StageStress)
+		{
+			static ForwardStage stage;
+			const size_t numSamples = 300000;
+
+			std::thread producer([&]()
+			{
+				for(size_t i = 0; i < numSamples; i++)
+				{
+					while(!stage.Push((double)i, 0.5, 0.001*(double)i))
+						std::this_thread::yield();
+				}
+			});
+
+			// Odd sized output, so Process() calls end part way through the ring
+			const size_t maxSamples = 77;
+			double d[maxSamples], q[maxSamples];
+			size_t numDone = 0;
+			double maxError = 0.0;
+			while(numDone < numSamples)
+			{
+				size_t num = stage.Process(d, q, maxSamples);
+				if(num == 0)
+					std::this_thread::yield();
+				for(size_t i = 0; i < num; i++, numDone++)
+				{
+					double theta = 0.001*(double)numDone;
+					maxError = fmax(maxError, fabs((double)numDone*cos(theta) + 0.5*sin(theta) - d[i]));
+					maxError = fmax(maxError, fabs(0.5*cos(theta) - (double)numDone*sin(theta) - q[i]));
+				}
+			}
+			producer.join();
+
+			// Scaled by the largest alpha, which is the sample number
+			CHECK(maxError < 1e-12*numSamples);
+
+			StageMetrics metrics = stage.GetMetrics();
+			CHECK_EQUAL((uint64_t)numSamples, metrics.numPushed);
+			CHECK_EQUAL((uint64_t)numSamples, metrics.numProcessed);
+			CHECK(metrics.maxOccupancy <= (uint32_t)configPARK_STAGE_RING_SIZE);
+			CHECK(metrics.meanOccupancy >= 1.0);
+			CHECK(metrics.meanLatencyNs > 0.0);
+			CHECK(metrics.maxLatencyNs >= metrics.LatencyPercentileNs(0.5)/2);
+
+			uint64_t histogramTotal = 0;
+			for(int i = 0; i < 40; i++)
+				histogramTotal += metrics.latencyHistogram[i];
+			CHECK_EQUAL((uint64_t)numSamples, histogramTotal);
+		}
+
+	} // SUITE(StageTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,101 @@
+//!
+//! @file 			SvpwmTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the fused inverse Park + space-vector PWM functions.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <math.h>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(SvpwmTests)
+	{
+		using namespace ParkTransform;
+
+		//! Separate Inverse(), inverse Clarke and min-max injection, in plain double maths
+		static void Reference(double d, double q, double theta, double *duties)
+		{
+			double alpha = d*cos(theta) - q*sin(theta);
+			double beta = q*cos(theta) + d*sin(theta);
+			double v[3] = { alpha, -0.5*alpha + 0.5*sqrt(3.0)*beta, -0.5*alpha - 0.5*sqrt(3.0)*beta };
+			double offset = 0.5 - 0.5*(fmax(v[0], fmax(v[1], v[2])) + fmin(v[0], fmin(v[1], v[2])));
+			for(int i = 0; i < 3; i++)
+				duties[i] = fmin(1.0, fmax(0.0, v[i] + offset));
+		}
+
+		TEST(MatchesSeparateStages)
+		{
+			Transformer transformer;
+			for(int i = 0; i < 100; i++)
+			{
+				// Includes overmodulation (magnitude > 1/sqrt(3)), which clamps
+				double d = 0.7*cos(0.3*i), q = 0.6*sin(0.7*i), theta = 0.0631*i;
+				double ref[3];
+				Reference(d, q, theta, ref);
+				Abc<double> duties = transformer.InverseSvpwm(d, q, theta);
+				CHECK_CLOSE(ref[0], duties.a, 1e-12);
+				CHECK_CLOSE(ref[1], duties.b, 1e-12);
+				CHECK_CLOSE(ref[2], duties.c, 1e-12);
+			}
+		}
+
+		TEST(LinearRangeReproducesVoltage)
+		{
+			// At the edge of the linear range the line-to-line voltages are recovered exactly
+			double magnitude = 1.0/sqrt(3.0) - 1e-9;
+			double dutyA, dutyB, dutyC;
+			Transformer transformer;
+			transformer.InverseSvpwm(magnitude, 0.0, 0.4, &dutyA, &dutyB, &dutyC);
+			double alpha = magnitude*cos(0.4), beta = magnitude*sin(0.4);
+			CHECK_CLOSE(1.5*alpha - 0.5*sqrt(3.0)*beta, dutyA - dutyB, 1e-12);
+			CHECK_CLOSE(sqrt(3.0)*beta, dutyB - dutyC, 1e-12);
+			CHECK(dutyA >= 0.0 && dutyA <= 1.0);
+		}
+
+		TEST(Q15)
+		{
+			typedef BasicTransformer<Q15, BamAngle<uint16_t>,
+				LutTrig<SinCosLut<256, 15>, LutInterpolation::LINEAR> > Q15Transformer;
+			typedef ScalarTraits<Q15> S;
+
+			double ref[3];
+			Reference(0.4, -0.3, 2.0, ref);
+			Abc<Q15> duties = Q15Transformer::InverseSvpwm(S::FromDouble(0.4), S::FromDouble(-0.3),
+				Bam16::FromRadians(2.0));
+			CHECK_CLOSE(ref[0], S::ToDouble(duties.a), 5e-4);
+			CHECK_CLOSE(ref[1], S::ToDouble(duties.b), 5e-4);
+			CHECK_CLOSE(ref[2], S::ToDouble(duties.c), 5e-4);
+		}
+
+		TEST(BatchMatchesScalar)
+		{
+			const size_t numSamples = 1003;
+			static double d[numSamples], q[numSamples], theta[numSamples];
+			static double dutyA[numSamples], dutyB[numSamples], dutyC[numSamples];
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				d[i] = 0.5*cos(0.37*i);
+				q[i] = 0.5*sin(0.11*i);
+				theta[i] = 0.01*i;
+			}
+
+			Transformer transformer;
+			transformer.InverseSvpwmBatch(d, q, theta, dutyA, dutyB, dutyC, numSamples);
+			for(size_t i = 0; i < numSamples; i++)
+			{
+				Abc<double> duties = transformer.InverseSvpwm(d[i], q[i], theta[i]);
+				CHECK_CLOSE(duties.a, dutyA[i], 1e-12);
+				CHECK_CLOSE(duties.b, dutyB[i], 1e-12);
+				CHECK_CLOSE(duties.c, dutyC[i], 1e-12);
+			}
+		}
+
+	} // SUITE(SvpwmTests)
+} // namespace ParkTransformTest
@@ -0,0 +1,120 @@
+//!
+//! @file 			TraceTests.cpp
+//! @author 		Geoffrey Hunter <gbmhunter@gmail.com> (www.cladlab.com)
+//! @created		2026/10/17
+//! @last-modified 	2026/10/17
+//! @brief			Tests for the trace policies and the trace drain.
+//! @details
+//!					See README.rst in root dir for more info.
+
+#include <thread>
+#include <type_traits>
+
+#include "../api/ParkTransform.hpp"
+
+#include "../lib/UnitTest++/src/UnitTest++.h"
+
+namespace ParkTransformTest
+{
+	SUITE(TraceTests)
+	{
+		using namespace ParkTransform;
+
+		typedef LutTrig<SinCosLut<256, 30, LutStorage::QUARTER_WAVE> > Trig;
+		typedef BasicTransformer<Q31, BamAngle<uint32_t>, Trig, RecordingTrace> TracedTransformer;
+
+		//! Adds up everything drained
+		class TotalSink : public TraceSink
+		{
+		public:
+			TotalSink() : numCalls(), histogram(), numSamples(0), numDropped(0) {}
+
+			void OnTrace(const TraceSnapshot &snapshot)
+			{
+				for(int i = 0; i < numTraceEvents; i++)
+					numCalls[i] += snapshot.callCounts[i];
+				for(int i = 0; i < configPARK_TRACE_HISTOGRAM_BINS; i++)
+					histogram[i] += snapshot.histogram[i];
+				numSamples += snapshot.numSamples;
+				numDropped += snapshot.numDroppedSamples;
+			}
+
+			uint64_t numCalls[numTraceEvents];
+			uint64_t histogram[configPARK_TRACE_HISTOGRAM_BINS];
+			uint64_t numSamples;
+			uint64_t numDropped;
+		};
+
+		//! Runs numCalls Forward() calls, at angles spread evenly around the turn
+		static void RunForward(uint32_t numCalls)
+		{
+			Q31 alpha = ScalarTraits<Q31>::FromDouble(0.5), beta = ScalarTraits<Q31>::FromDouble(0.25);
+			for(uint32_t i = 0; i < numCalls; i++)
+			{
+				Q31 d, q;
+				TracedTransformer::Forward(alpha, beta, Bam32((uint32_t)(((uint64_t)i << 32)/numCalls)), &d, &q);
+			}
+		}
+
+		TEST(NullTraceIsEmpty)
+		{
+			static_assert(std::is_empty<NullTrace::Scope>::value, "NullTrace must add no state");
+			static_assert(std::is_trivially_destructible<NullTrace::Scope>::value, "NullTrace must add no code");
+		}
+
+		TEST(CountsHistogramAndSamples)
+		{
+			TotalSink sink;
+			while(!DrainTrace(sink)) {}		// Anything from earlier tests
+			sink = TotalSink();
+
+			const uint32_t numCalls = 64*configPARK_TRACE_HISTOGRAM_BINS;
+			RunForward(numCalls);
+			Q31 alpha, beta;
+			TracedTransformer::Inverse(ScalarTraits<Q31>::FromDouble(0.1), ScalarTraits<Q31>::FromDouble(0.1),
+				Bam32(0u), &alpha, &beta);
+			CHECK(DrainTrace(sink));
+
+			CHECK_EQUAL(numCalls, sink.numCalls[(int)TraceEvent::FORWARD]);
+			CHECK_EQUAL(1u, sink.numCalls[(int)TraceEvent::INVERSE]);
+			CHECK_EQUAL(numCalls + 1, sink.numCalls[(int)TraceEvent::CALC_ROTATION]);
+
+			// Evenly spread angles, so every bin gets the same count (bin 0 also has the Inverse())
+			CHECK_EQUAL(65u, sink.histogram[0]);
+			for(int i = 1; i < configPARK_TRACE_HISTOGRAM_BINS; i++)
+				CHECK_EQUAL(64u, sink.histogram[i]);
+
+			// +-1, a reused buffer carries on from where its last thread got to
+			CHECK_CLOSE(numCalls/configPARK_TRACE_SAMPLE_INTERVAL, (double)(sink.numSamples + sink.numDropped), 1.0);
+
+			// Nothing new, nothing drained
+			TotalSink empty;
+			DrainTrace(empty);
+			CHECK_EQUAL(0u, empty.numCalls[(int)TraceEvent::FORWARD]);
+		}
+
+		TEST(ThreadsRecordSeparatelyAndDrainAsynchronously)
+		{
+			TotalSink sink;
+			while(!DrainTrace(sink)) {}
+			sink = TotalSink();
+
+			const uint32_t numCalls = 100000;
+			{
+				TraceDrainThread drainThread(sink, 1);
+				std::thread first(RunForward, numCalls);
+				std::thread second(RunForward, numCalls);
+				first.join();
+				second.join();
+			}	// Joins the drain thread, after a final drain
+
+			CHECK_EQUAL(2*numCalls, sink.numCalls[(int)TraceEvent::FORWARD]);
+			uint64_t histogramTotal = 0;
+			for(int i = 0; i < configPARK_TRACE_HISTOGRAM_BINS; i++)
+				histogramTotal += sink.histogram[i];
+			CHECK_EQUAL(2*numCalls, histogramTotal);
+			CHECK_CLOSE(2*(numCalls/configPARK_TRACE_SAMPLE_INTERVAL), (double)(sink.numSamples + sink.numDropped), 2.0);
+		}
+
+	} // SUITE(TraceTests)
+} // namespace ParkTransformTest